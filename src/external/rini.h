@@ -1,13 +1,13 @@
 /**********************************************************************************************
 *
-*   rini v3.0 - A simple and easy-to-use ini-style files reader and writer
+*   rini v3.1 - A simple and easy-to-use ini-style files reader and writer
 *
 *   DESCRIPTION:
 *       Load and save ini-style files with keys and values
 *
 *   FEATURES:
 *       - Init/Config files reading and writing
-*       - Supported value types: int, string
+*       - Supported value types: int, float, bool, string, string list (parsed once on loading)
 *       - Support comment lines and empty lines
 *       - Support custom line comment delimiter
 *       - Support custom value delimiters
@@ -15,12 +15,22 @@
 *       - Support custom description custom delimiter
 *       - Support multi-word text values w/o quote delimiters
 *       - Support custom key and value spacings
-*       - Customizable maximum values capacity
+*       - Unlimited values, values array grows as required
+*       - Variable-length values, key, text and description stored in a strings pool
+*       - Keys hash index, built on loading and updated on setting, O(1) values lookup (read-only)
+*       - Streaming zero-copy parser, entries as slices into caller buffer (no lines limit)
+*       - Support [sections], section-scoped values lookup, values grouped by section on saving
 *       - Minimal C standard lib dependency (optional)
 *
 *   LIMITATIONS:
-*       - [sections] lines not supported
-*       - Saving file requires complete rewrite
+*       - Comment lines are not loaded, only added by code (saved before any section)
+*       - Saving file requires complete rewrite (single write to temp file, atomically replaced)
+*
+*   USAGE:
+*       - rini_load() reads file into a temporary heap buffer (fread()), values are copied
+*         into the strings pool, file data is not kept (no memory mapping)
+*       - Zero-copy parsing: rini_parser_init() on a caller provided buffer (i.e. memory-mapped file),
+*         rini_parse_next() entries are slices into that buffer, valid while buffer is kept
 *
 *   POSSIBLE IMPROVEMENTS:
 *       - Support disabled key-value entries
@@ -31,25 +41,23 @@
 *           If not defined, the library is in header only mode and can be included in other headers
 *           or source files without problems. But only ONE file should hold the implementation.
 *
-*       #define RINI_MAX_LINE_SIZE
-*           Defines the maximum size of line buffer to read from file.
-*           Default value: 512 bytes (considering [key + text + desc] is 256 max size by default)
-*
-*       #define RINI_MAX_KEY_SIZE
-*           Defines the maximum size of value key
-*           Default value: 64 bytes
+*       #define RINI_POOL_BLOCK_SIZE
+*           Defines the size of the strings pool blocks, values key, text and description
+*           are stored in the pool with no size limit, bigger strings get a dedicated block
+*           Default value: 4096 bytes
 *
-*       #define RINI_MAX_TEXT_SIZE
-*           Defines the maximum size of value text
-*           Default value: 128 bytes
+*       #define RINI_INITIAL_VALUE_CAPACITY
+*           Defines the number of values allocated on first value addition,
+*           values array grows geometrically (x2) as required, no values limit
+*           Default value: 16 entries
 *
-*       #define RINI_MAX_DESC_SIZE
-*           Defines the maximum size of value description
-*           Default value: 128 bytes
+*       #define RINI_NO_HASH_INDEX
+*           Disables keys hash index, values are looked up with a linear search
 *
-*       #define RINI_MAX_VALUE_CAPACITY
-*           Defines the maximum number of values supported
-*           Default value: 128 entries support
+*       #define RINI_HASH_INDEX_MIN_VALUES
+*           Defines the minimum number of values to use the keys hash index,
+*           linear search is faster for smaller configs
+*           Default value: 16 values
 *
 *       #define RINI_LINE_COMMENT_DELIMITER
 *           Define character used to comment lines, placed at beginning of line
@@ -57,8 +65,9 @@
 *           Default value: '#'
 *
 *       #define RINI_LINE_SECTION_DELIMITER
-*           Defines section lines start character
-*           Sections loading is not supported, lines are just skipped for now
+*           Defines section lines start character, section name ends with ']'
+*           Values following a section line belong to that section, values before any
+*           section line belong to global section (no name), accessed by non-section functions
 *           Default value: '['
 *
 *       #define RINI_VALUE_DELIMITER
@@ -72,17 +81,49 @@
 *           in case of float values they are always considered as text
 *           Default value: '\"'
 *
+*       #define RINI_VALUE_LIST_DELIMITER
+*           Defines items separator for text values containing a list of items
+*           Text values containing the delimiter are considered string lists
+*           Default value: ';'
+*
 *       #define RINI_DESCRIPTION_DELIMITER
 *           Defines a property line-end comment delimiter
 *           This implementation allows adding inline comments after the value.
 *           Default value: '#'
 *
 *   DEPENDENCIES: C standard library:
-*       - stdio.h: fopen(), feof(), fgets(), fclose(), fprintf()
-*       - stdlib.h: malloc(), calloc(), free()
-*       - string.h: memset(), memcpy(), strcmp(), strlen()
+*       - stdio.h: fopen(), fread(), fseek(), ftell(), fclose(), rename(), remove(), snprintf()
+*       - stdlib.h: malloc(), calloc(), realloc(), free()
+*       - string.h: memset(), memcpy(), memcmp(), strcmp(), strlen(), strpbrk()
+*       - POSIX: open(), write(), fsync(), close() - Windows: _open(), _write(), _commit(), _close(), MoveFileExA()
 *
 *   VERSIONS HISTORY:
+*       3.1 (xx-Oct-2026) ADDED: Streaming zero-copy parser: rini_parser_init(), rini_parse_next()
+*                         ADDED: rini_slice, rini_entry, slices copied on demand with rini_slice_copy()
+*                         REVIEWED: rini_load(), rini_load_from_memory(), single pass, no lines limit
+*                         REVIEWED: Description delimiter not considered inside quoted text values
+*                         REVIEWED: Values array grows as required, RINI_MAX_VALUE_CAPACITY replaced
+*                                   by RINI_INITIAL_VALUE_CAPACITY, values are never dropped
+*                         FIXED: rini_set_value() setting last value as not text instead of key value
+*                         ADDED: rini_save_to_buffer(), save to caller buffer with required size query
+*                         ADDED: rini_unload_text(), unload text returned by rini_save_to_memory()
+*                         BREAKING: rini_save_to_memory() returns an allocated buffer (exact size, reentrant)
+*                         ADDED: Keys hash index on rini_data, built on loading, updated on set, lookups never modify data
+*                         REDESIGN: Values key, text and description stored in a strings pool, no size limit
+*                         REMOVED: RINI_MAX_LINE_SIZE, RINI_MAX_KEY_SIZE, RINI_MAX_TEXT_SIZE, RINI_MAX_DESC_SIZE
+*                         REVIEWED: rini_save(), single buffer write to temp file, flushed and renamed (atomic)
+*                         BREAKING: rini_save() returns 0 on success, saved line endings are always '\n'
+*                         ADDED: [sections] support, rini_section, values section, entry section
+*                         ADDED: rini_get_section_value(), rini_get_section_value_text()
+*                         ADDED: rini_set_section_value(), rini_set_section_value_text()
+*                         BREAKING: Values after a section line are only accessed by section functions
+*                         ADDED: Typed values (int, float, bool, string, string list), parsed once on loading/setting
+*                         ADDED: rini_get_value_type(), rini_get_value_float(), rini_set_value_float()
+*                         ADDED: rini_get_value_list_count(), rini_get_value_list_item()
+*                         FIXED: Values and descriptions trailing tabs and carriage returns not trimmed
+*                         REVIEWED: Entries without key (line starting with spaces) skipped on loading, dropped on saving
+*                         FIXED: Numbers out of int/float range kept as text values (no overflow on parsing)
+*
 *       3.0 (xx-May-2025) REDESIGN: BREAKING: Removed the _config_ in naming
 *                         ADDED: Flag to consider a text entry as text
 *                         ADDED: Key and Value spacing defines
@@ -124,7 +165,7 @@
 #ifndef RINI_H
 #define RINI_H
 
-#define RINI_VERSION    "3.0"
+#define RINI_VERSION    "3.1"
 
 // Function specifiers in case library is build/used as a shared library (Windows)
 // NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
@@ -151,6 +192,9 @@
 #ifndef RINI_CALLOC
     #define RINI_CALLOC(n,sz)     calloc(n,sz)
 #endif
+#ifndef RINI_REALLOC
+    #define RINI_REALLOC(p,sz)    realloc(p,sz)
+#endif
 #ifndef RINI_FREE
     #define RINI_FREE(p)          free(p)
 #endif
@@ -164,24 +208,16 @@
   #define RINI_LOG(...)
 #endif
 
-#if !defined(RINI_MAX_LINE_SIZE)
-    #define RINI_MAX_LINE_SIZE              512
-#endif
-
-#if !defined(RINI_MAX_KEY_SIZE)
-    #define RINI_MAX_KEY_SIZE                64
-#endif
-
-#if !defined(RINI_MAX_TEXT_SIZE)
-    #define RINI_MAX_TEXT_SIZE              128
+#if !defined(RINI_POOL_BLOCK_SIZE)
+    #define RINI_POOL_BLOCK_SIZE           4096
 #endif
 
-#if !defined(RINI_MAX_DESC_SIZE)
-    #define RINI_MAX_DESC_SIZE              128
+#if !defined(RINI_INITIAL_VALUE_CAPACITY)
+    #define RINI_INITIAL_VALUE_CAPACITY      16
 #endif
 
-#if !defined(RINI_MAX_VALUE_CAPACITY)
-    #define RINI_MAX_VALUE_CAPACITY         128
+#if !defined(RINI_HASH_INDEX_MIN_VALUES)
+    #define RINI_HASH_INDEX_MIN_VALUES       16
 #endif
 
 // Total space reserved for Key,
@@ -200,7 +236,7 @@
     #define RINI_LINE_COMMENT_DELIMITER     '#'
 #endif
 
-// Line section delimiter -NOT USED-
+// Line section delimiter (starting char), section name ends with ']'
 #if !defined(RINI_LINE_SECTION_DELIMITER)
     #define RINI_LINE_SECTION_DELIMITER     '['
 #endif
@@ -223,24 +259,98 @@
     #define RINI_DESCRIPTION_DELIMITER      '#'
 #endif
 
+// List delimiter, separator between text value list items
+#if !defined(RINI_VALUE_LIST_DELIMITER)
+    #define RINI_VALUE_LIST_DELIMITER       ';'
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+// rini value type, decided once when value is loaded or set
+typedef enum {
+    RINI_TYPE_STRING = 0,       // Text value, quoted or not a number (int_value: leading integer if not quoted, saturated)
+    RINI_TYPE_INT,              // Integer value: [+-]digits, not quoted
+    RINI_TYPE_FLOAT,            // Float value: [+-]digits.digits[e[+-]digits], not quoted
+    RINI_TYPE_BOOL,             // Bool value: true/false, not quoted (int_value: 1/0)
+    RINI_TYPE_STRING_LIST       // Text value containing RINI_VALUE_LIST_DELIMITER separated items
+} rini_value_type;
+
+// rini typed value, tagged by rini_value_type
+typedef union {
+    int int_value;              // Integer value (RINI_TYPE_INT, RINI_TYPE_BOOL, RINI_TYPE_STRING)
+    float float_value;          // Float value (RINI_TYPE_FLOAT)
+    unsigned int list_count;    // List items count (RINI_TYPE_STRING_LIST)
+} rini_typed_value;
+
 // rini value entry
+// NOTE: Strings are NULL terminated, stored in rini_data strings pool
 typedef struct {
-    char key[RINI_MAX_KEY_SIZE];    // Value key identifier
-    char text[RINI_MAX_TEXT_SIZE];  // Value text
-    char desc[RINI_MAX_DESC_SIZE];  // Value description
-    bool is_text;                   // Value should be considered as text
+    const char *key;            // Value key identifier
+    const char *text;           // Value text
+    const char *desc;           // Value description
+    unsigned int key_len;       // Value key length
+    unsigned int text_len;      // Value text length
+    unsigned int desc_len;      // Value description length
+    unsigned int section;       // Value section index (0: global section, values before any section)
+    bool is_text;               // Value should be considered as text
+    int type;                   // Value type (rini_value_type)
+    rini_typed_value typed;     // Value typed data, parsed from text
 } rini_value;
 
+// rini section
+typedef struct {
+    const char *name;           // Section name (global section: empty name)
+    unsigned int name_len;      // Section name length
+} rini_section;
+
+// rini keys hash index (opaque)
+typedef struct rini_index rini_index;
+
+// rini strings pool block (opaque)
+typedef struct rini_pool_block rini_pool_block;
+
 // rini data
+// NOTE: Keys hash index and strings pool are shared by rini_data copies, index is built on loading
+// and updated on setting values, lookups never modify data (concurrent lookups supported while not setting)
 typedef struct {
     rini_value *values;         // Values array
     unsigned int count;         // Values count
     unsigned int capacity;      // Values capacity
+    rini_index *index;          // Keys hash index (optional)
+    rini_pool_block *pool;      // Strings pool, values key, text and description storage
+    rini_section *sections;     // Sections array, sections[0] is global section (created with first section)
+    unsigned int section_count; // Sections count
 } rini_data;
 
+// rini slice, text view into parsed buffer
+// WARNING: Slice text is not NULL terminated, use rini_slice_copy()
+typedef struct {
+    const char *ptr;            // Slice text start
+    unsigned int len;           // Slice text length
+} rini_slice;
+
+// rini parsed entry, slices point into parsed buffer (zero-copy)
+typedef struct {
+    rini_slice key;             // Entry key identifier
+    rini_slice text;            // Entry value text (without quotation marks)
+    rini_slice desc;            // Entry value description
+    rini_slice section;         // Entry section name (empty for global section)
+    bool is_text;               // Entry value should be considered as text
+    int type;                   // Entry value type (rini_value_type)
+    rini_typed_value typed;     // Entry value typed data, parsed from text
+} rini_entry;
+
+// rini parser, streaming entries from buffer
+// NOTE: Buffer is owned by caller (loaded or memory-mapped), it must be kept while entries are used
+typedef struct {
+    const char *buffer;         // Text buffer to parse, not required to be NULL terminated
+    unsigned int size;          // Text buffer size
+    unsigned int offset;        // Current parsing offset
+    unsigned int line;          // Current line number (last parsed line)
+    rini_slice section;         // Current section name (last section line parsed)
+} rini_parser;
+
 #if defined(__cplusplus)
 extern "C" {                    // Prevents name mangling of functions
 #endif
@@ -248,30 +358,51 @@ extern "C" {                    // Prevents name mangling of functions
 //------------------------------------------------------------------------------------
 // Functions declaration
 //------------------------------------------------------------------------------------
-RINIAPI rini_data rini_load(const char *file_name);         // Load data from file (*.ini) or create a new rini object (pass NULL)
+RINIAPI rini_data rini_load(const char *file_name);         // Load data from file (*.ini) or create a new rini object (pass NULL), no values allocated
 RINIAPI rini_data rini_load_from_memory(const char *text);  // Load data from text buffer
-RINIAPI void rini_save(rini_data data, const char *file_name); // Save data to file, with custom header
-RINIAPI char *rini_save_to_memory(rini_data data);          // Save data to text buffer ('\0' EOL)
+RINIAPI int rini_save(rini_data data, const char *file_name); // Save data to file atomically, returns 0 on success
+RINIAPI char *rini_save_to_memory(rini_data data);          // Save data to text buffer ('\0' EOL), allocated, unload with rini_unload_text()
+RINIAPI int rini_save_to_buffer(rini_data data, char *buffer, int buffer_size); // Save data to caller buffer ('\0' EOL), returns required size (buffer NULL to query size)
+RINIAPI void rini_unload_text(char *text);                  // Unload text buffer returned by rini_save_to_memory()
 RINIAPI void rini_unload(rini_data *data);                  // Unload data from memory
 
+// Streaming parser, no memory allocated, entries text copied on demand
+RINIAPI rini_parser rini_parser_init(const char *buffer, unsigned int size); // Init parser for text buffer (caller owned)
+RINIAPI bool rini_parse_next(rini_parser *parser, rini_entry *entry); // Parse next entry, returns false when buffer end reached
+RINIAPI int rini_slice_copy(rini_slice slice, char *dst, int dst_size); // Copy slice text to NULL terminated buffer (truncated if required), returns copied length
+RINIAPI bool rini_slice_equals(rini_slice slice, const char *text); // Check if slice text is equal to NULL terminated text
+
 RINIAPI int rini_get_value(rini_data data, const char *key); // Get value int for provided key, returns 0 if not found
-RINIAPI const char *rini_get_value_text(rini_data data, const char *key); // Get value text for provided key
+RINIAPI const char *rini_get_value_text(rini_data data, const char *key); // Get value text for provided key (valid until value is set again or data unloaded)
 RINIAPI const char *rini_get_value_description(rini_data data, const char *key); // Get value description for provided key
 
 RINIAPI int rini_get_value_fallback(rini_data data, const char *key, int fallback); // Get value for provided key with default value fallback if not found or not valid
 RINIAPI const char *rini_get_value_text_fallback(rini_data data, const char *key, const char *fallback); // Get value text for provided key with fallback if not found or not valid
 
+RINIAPI int rini_get_value_type(rini_data data, const char *key); // Get value type (rini_value_type) for provided key, returns -1 if not found
+RINIAPI float rini_get_value_float(rini_data data, const char *key); // Get value float for provided key, returns 0.0f if not found
+RINIAPI int rini_get_value_list_count(rini_data data, const char *key); // Get value list items count for provided key (1 for not list values, 0 if not found)
+RINIAPI rini_slice rini_get_value_list_item(rini_data data, const char *key, int index); // Get value list item for provided key, spaces trimmed (empty slice if not found)
+
 RINIAPI int rini_set_comment_line(rini_data *data, const char *comment); // Set comment line
 
 // Set value int/text and description for existing key or create a new entry
 // NOTE: When setting a text value, if id does not exist, a new entry is automatically created
 RINIAPI int rini_set_value(rini_data *data, const char *key, int value, const char *desc);
 RINIAPI int rini_set_value_text(rini_data *data, const char *key, const char *text, const char *desc);
+RINIAPI int rini_set_value_float(rini_data *data, const char *key, float value, const char *desc);
 
 // Set value description for existing key
 // WARNING: Key must exist to add description, if a description exists, it is updated
 RINIAPI int rini_set_value_description(rini_data *data, const char *key, const char *desc);
 
+// Get/set values scoped to a section, NULL or empty section refers to global section
+// NOTE: Setting a value on a section that does not exist creates the section
+RINIAPI int rini_get_section_value(rini_data data, const char *section, const char *key); // Get section value int for provided key, returns 0 if not found
+RINIAPI const char *rini_get_section_value_text(rini_data data, const char *section, const char *key); // Get section value text for provided key
+RINIAPI int rini_set_section_value(rini_data *data, const char *section, const char *key, int value, const char *desc);
+RINIAPI int rini_set_section_value_text(rini_data *data, const char *section, const char *key, const char *text, const char *desc);
+
 #ifdef __cplusplus
 }
 #endif
@@ -286,15 +417,56 @@ RINIAPI int rini_set_value_description(rini_data *data, const char *key, const c
 
 #if defined(RINI_IMPLEMENTATION)
 
-#include <stdio.h>          // Required for: fopen(), feof(), fgets(), fclose(), fprintf()
-#include <stdlib.h>         // Required for: malloc(), calloc(), free()
-#include <string.h>         // Required for: memset(), memcpy(), strcmp(), strlen()
+#include <stdio.h>          // Required for: fopen(), fread(), fseek(), ftell(), fclose(), rename(), remove(), snprintf()
+#include <stdlib.h>         // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>         // Required for: memset(), memcpy(), memcmp(), strcmp(), strlen(), strpbrk()
+#include <limits.h>         // Required for: INT_MAX, INT_MIN
+#include <float.h>          // Required for: FLT_MAX
+
+// Atomic file saving support: single write, flush to disk and replace
+#if defined(_WIN32)
+    #include <io.h>         // Required for: _open(), _write(), _commit(), _close()
+    #include <fcntl.h>      // Required for: _O_WRONLY, _O_CREAT, _O_TRUNC, _O_BINARY
+    #include <sys/stat.h>   // Required for: _S_IREAD, _S_IWRITE
+
+    // NOTE: Avoiding <windows.h> inclusion, it conflicts with some libraries (raylib)
+    __declspec(dllimport) int __stdcall MoveFileExA(const char *lpExistingFileName, const char *lpNewFileName, unsigned long dwFlags);
+#else
+    #include <fcntl.h>      // Required for: open()
+    #include <unistd.h>     // Required for: write(), fsync(), close()
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and macros
 //----------------------------------------------------------------------------------
 // ...
 
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// rini keys hash index slot
+typedef struct {
+    unsigned int hash;          // Key hash
+    unsigned int value;         // Value index + 1, 0 if slot empty
+} rini_index_slot;
+
+// rini keys hash index, open addressing (linear probing), keys hashed with their section
+// NOTE: First value is indexed for duplicated keys, same as linear search
+struct rini_index {
+    rini_index_slot *slots;     // Index slots
+    unsigned int slot_count;    // Index slots count (power of two)
+    unsigned int value_count;   // Values indexed, remaining values indexed on next lookup
+};
+
+// rini strings pool block, strings are appended and never moved
+// NOTE: Blocks are only released on rini_unload()
+struct rini_pool_block {
+    rini_pool_block *next;      // Next pool block
+    unsigned int size;          // Block data size
+    unsigned int used;          // Block data used
+    char data[];                // Block data
+};
+
 //----------------------------------------------------------------------------------
 // Global variables definition
 //----------------------------------------------------------------------------------
@@ -303,75 +475,63 @@ RINIAPI int rini_set_value_description(rini_data *data, const char *key, const c
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
-static int rini_read_key(const char *buffer, char *key); // Get key from a buffer line containing key-value-(description)
-static int rini_read_value_text(const char *buffer, char *text, char *desc, bool *is_text); // Get value text (and description) from a buffer line
-
-static int rini_text_to_int(const char *text); // Convert text to int value (if possible), same as atoi()
+static void rini_parse_line(const char *line, unsigned int len, rini_entry *entry); // Parse entry slices from a buffer line containing key-value-(description)
+static void rini_load_values(rini_data *data, const char *buffer, unsigned int size); // Load values from text buffer, single pass
+static bool rini_reserve_values(rini_data *data, unsigned int count); // Reserve values capacity, growing geometrically
+static int rini_write_value_line(const rini_value *value, char *buffer); // Write value line to buffer (if provided), returns line length
+static int rini_find_value(rini_data data, int section, const char *key); // Find value index by section and key, returns -1 if not found
+static int rini_find_section(rini_data data, const char *name, unsigned int len); // Find section index by name, returns -1 if not found
+static int rini_add_section(rini_data *data, const char *name, unsigned int len); // Add section (if not found), returns section index
+static int rini_write_values(rini_data data, char *buffer); // Write values lines grouped by section to buffer (if provided), returns length
+#if !defined(RINI_NO_HASH_INDEX)
+static unsigned int rini_hash_key(unsigned int section, const char *key); // Compute section key hash (FNV-1a)
+static bool rini_index_update(rini_data data); // Update keys hash index with values not indexed yet (loading and setting only)
+#endif
+static int rini_write_text(char *buffer, int offset, const char *text, int length, int spacing); // Write text to buffer (if provided), padded with spaces
+static bool rini_write_file_atomic(const char *temp_file_name, const char *file_name, const char *text, int size); // Write text to temp file, flush and replace file
+static rini_pool_block *rini_pool_add_block(rini_data *data, unsigned int size, bool dedicated); // Add strings pool block
+static const char *rini_pool_store(rini_data *data, const char *text, unsigned int len); // Store string in pool, returns NULL terminated copy
+static bool rini_set_string(rini_data *data, const char **string, unsigned int *string_len, const char *text, unsigned int len); // Set value string, reusing its storage if possible
+static int rini_set_value_ex(rini_data *data, int section, const char *key, const char *text, const char *desc, bool is_text); // Set value text, description and type
+
+static int rini_parse_typed(const char *text, unsigned int len, bool is_text, rini_typed_value *typed); // Parse value typed data from text, returns value type
+static int rini_value_to_int(const rini_value *value); // Get value as int, from typed data
+static int rini_text_to_int(const char *text, unsigned int len, bool *overflow); // Convert text to int value (if possible), saturated to int range
+static float rini_text_to_float(const char *text, unsigned int len, unsigned int *parsed, bool *overflow); // Convert text to float value (locale independent), returns parsed length
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
 // Load data from file (.ini)
+// NOTE: File is read into a temporary heap buffer and parsed in a single pass,
+// use rini_parser_init() on a caller buffer (i.e. memory-mapped file) for zero-copy parsing
 rini_data rini_load(const char *file_name)
 {
     rini_data data = { 0 };
-    unsigned int value_counter = 0;
 
-    // Init data to max capacity
-    data.capacity = RINI_MAX_VALUE_CAPACITY;
-    data.values = (rini_value *)RINI_CALLOC(RINI_MAX_VALUE_CAPACITY, sizeof(rini_value));
+#if !defined(RINI_NO_HASH_INDEX)
+    data.index = (rini_index *)RINI_CALLOC(1, sizeof(rini_index));
+#endif
 
+    // NOTE: Values array is allocated when first value is added
     if (file_name != NULL)
     {
-        FILE *rini_file = fopen(file_name, "rt");
+        FILE *rini_file = fopen(file_name, "rb");
 
         if (rini_file != NULL)
         {
-            char buffer[RINI_MAX_LINE_SIZE] = { 0 };    // Buffer to read every text line
+            fseek(rini_file, 0, SEEK_END);
+            long size = ftell(rini_file);
+            fseek(rini_file, 0, SEEK_SET);
 
-            // First pass to count valid lines
-            while (fgets(buffer, RINI_MAX_LINE_SIZE, rini_file))
+            if (size > 0)
             {
-                // WARNING: fgets() keeps line endings, doesn't have any special options for converting line endings,
-                // but on Windows, when reading file 'rt', line endings are converted from \r\n to just \n
-
-                // Skip commented lines and empty lines
-                // NOTE: We are also skipping sections delimiters
-                if ((buffer[0] != RINI_LINE_COMMENT_DELIMITER) &&
-                    (buffer[0] != RINI_LINE_SECTION_DELIMITER) &&
-                    (buffer[0] != '\n') && (buffer[0] != '\r') && (buffer[0] != '\0')) value_counter++;
-            }
+                char *buffer = (char *)RINI_MALLOC(size);
+                unsigned int read_size = (unsigned int)fread(buffer, 1, size, rini_file);
 
-            // WARNING: We can't store more values than its max capacity
-            data.count = (value_counter > RINI_MAX_VALUE_CAPACITY)? RINI_MAX_VALUE_CAPACITY : value_counter;
+                rini_load_values(&data, buffer, read_size);
 
-            if (data.count > 0)
-            {
-                rewind(rini_file);
-                value_counter = 0;
-
-                // Second pass to read data
-                while (fgets(buffer, RINI_MAX_LINE_SIZE, rini_file))
-                {
-                    // WARNING: fgets() keeps line endings, doesn't have any special options for converting line endings,
-                    // but on Windows, when reading file 'rt', line endings are converted from \r\n to just \n
-
-                    // Skip commented lines and empty lines
-                    if ((buffer[0] != RINI_LINE_COMMENT_DELIMITER) &&
-                        (buffer[0] != RINI_LINE_SECTION_DELIMITER) &&
-                        (buffer[0] != '\n') && (buffer[0] != '\r') && (buffer[0] != '\0'))
-                    {
-                        // Get key identifier string
-                        memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);
-                        rini_read_key(buffer, data.values[value_counter].key);
-                        rini_read_value_text(buffer, data.values[value_counter].text, data.values[value_counter].desc, &data.values[value_counter].is_text);
-
-                        value_counter++;
-
-                        // Stop reading if first count reached to avoid overflow in case count == RINI_MAX_VALUE_CAPACITY
-                        if (value_counter >= data.count) break;
-                    }
-                }
+                RINI_FREE(buffer);
             }
 
             fclose(rini_file);
@@ -385,152 +545,77 @@ rini_data rini_load(const char *file_name)
 // NOTE: Comments and empty lines are ignored
 rini_data rini_load_from_memory(const char *text)
 {
-    #define RINI_MAX_TEXT_LINES     RINI_MAX_VALUE_CAPACITY*2       // Consider possible comments and empty lines
-
     rini_data data = { 0 };
-    unsigned int value_counter = 0;
-
-    // Init data to max capacity
-    data.capacity = RINI_MAX_VALUE_CAPACITY;
-    data.values = (rini_value *)RINI_CALLOC(RINI_MAX_VALUE_CAPACITY, sizeof(rini_value));
-
-    if (text != NULL)
-    {
-        // Split text by line-breaks
-        const char *lines[RINI_MAX_TEXT_LINES] = { 0 };
-        int textSize = (int)strlen(text);
-        lines[0] = text;
-        int line_counter = 1;
-
-        for (int i = 0, k = 1; (i < textSize) && (line_counter < RINI_MAX_TEXT_LINES); i++)
-        {
-            if (text[i] == '\n')
-            {
-                lines[k] = &text[i + 1]; // WARNING: next value is valid?
-                line_counter += 1;
-                k++;
-            }
-        }
 
-        // Count possible values in lines
-        for (int l = 0; l < line_counter; l++)
-        {
-            // Skip commented lines and empty lines
-            // NOTE: We are also skipping sections delimiters
-            if ((lines[l][0] != RINI_LINE_COMMENT_DELIMITER) &&
-                (lines[l][0] != RINI_LINE_SECTION_DELIMITER) &&
-                (lines[l][0] != '\n') && (lines[l][0] != '\r') && (lines[l][0] != '\0')) value_counter++;
-        }
-
-        // WARNING: We can't store more values than its max capacity
-        data.count = (value_counter > RINI_MAX_VALUE_CAPACITY)? RINI_MAX_VALUE_CAPACITY : value_counter;
-
-        // Process lines to get keys and values
-        if (data.count > 0)
-        {
-            value_counter = 0;
+#if !defined(RINI_NO_HASH_INDEX)
+    data.index = (rini_index *)RINI_CALLOC(1, sizeof(rini_index));
+#endif
 
-            // Second pass to read data
-            for (int l = 0; l < line_counter; l++)
-            {
-                // Skip commented lines and empty lines
-                if ((lines[l][0] != RINI_LINE_COMMENT_DELIMITER) &&
-                    (lines[l][0] != RINI_LINE_SECTION_DELIMITER) &&
-                    (lines[l][0] != '\n') && (lines[l][0] != '\r') && (lines[l][0] != '\0'))
-                {
-                    // Get key identifier string
-                    memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);
-                    rini_read_key(lines[l], data.values[value_counter].key);
-                    rini_read_value_text(lines[l], data.values[value_counter].text, data.values[value_counter].desc, &data.values[value_counter].is_text);
-
-                    value_counter++;
-
-                    // Stop reading if first count reached to avoid overflow in case count == RINI_MAX_VALUE_CAPACITY
-                    if (value_counter >= data.count) break;
-                }
-            }
-        }
-    }
+    if (text != NULL) rini_load_values(&data, text, (unsigned int)strlen(text));
 
     return data;
 }
 
 // Save data to file (*.ini)
-void rini_save(rini_data data, const char *file_name)
+// NOTE: Data is serialized into a single buffer and written to a temp file (file_name + ".tmp"),
+// flushed to disk and renamed to destination, a crash while saving never leaves a truncated file
+int rini_save(rini_data data, const char *file_name)
 {
-    FILE *rini_file = fopen(file_name, "wt");
+    int result = -1;
 
-    if (rini_file != NULL)
-    {
-        char valuestr[RINI_MAX_TEXT_SIZE + 2] = { 0 }; // Useful for text processing, adding quotation marks if required
+    if (file_name == NULL) return result;
 
-        for (unsigned int i = 0; i < data.count; i++)
-        {
-            if ((data.values[i].key[0] == '\0') && (data.values[i].text[0] == RINI_LINE_COMMENT_DELIMITER))
-            {
-                if (data.values[i].desc[0] != '\0') fprintf(rini_file, "%c %s\n", RINI_LINE_COMMENT_DELIMITER, data.values[i].desc);
-                else fprintf(rini_file, "%c\n", RINI_LINE_COMMENT_DELIMITER);
-            }
-            else
-            {
-                memset(valuestr, 0, RINI_MAX_TEXT_SIZE + 2);
-#if RINI_USE_TEXT_QUOTATION_MARKS
-                // Add quotation marks if required
-                if (data.values[i].is_text) snprintf(valuestr, 130, "%c%s%c", RINI_VALUE_QUOTATION_MARKS, data.values[i].text, RINI_VALUE_QUOTATION_MARKS);
-#else
-                snprintf(valuestr, RINI_MAX_TEXT_SIZE + 2, "%s", data.values[i].text);
-#endif
-                fprintf(rini_file, "%-*s %c %-*s %c %s\n", RINI_KEY_SPACING, data.values[i].key, RINI_VALUE_DELIMITER,
-                    RINI_VALUE_SPACING, data.values[i].is_text? valuestr : data.values[i].text, 
-                    RINI_DESCRIPTION_DELIMITER, data.values[i].desc);
-            }
-        }
+    int size = rini_save_to_buffer(data, NULL, 0);
+    char *text = (char *)RINI_MALLOC(size + 1);
+    char *temp_file_name = (char *)RINI_MALLOC(strlen(file_name) + 5);
+
+    if ((text != NULL) && (temp_file_name != NULL))
+    {
+        rini_save_to_buffer(data, text, size + 1);
+        snprintf(temp_file_name, strlen(file_name) + 5, "%s.tmp", file_name);
 
-        fclose(rini_file);
+        if (rini_write_file_atomic(temp_file_name, file_name, text, size)) result = 0;
+        else RINI_LOG("WARNING: RINI: [%s] Failed to save file\n", file_name);
     }
+
+    RINI_FREE(text);
+    RINI_FREE(temp_file_name);
+
+    return result;
 }
 
 // Save data to text buffer ('\0' EOL)
+// NOTE: Buffer is allocated with exact required size, it must be unloaded with rini_unload_text()
 char *rini_save_to_memory(rini_data data)
 {
-    #define RINI_MAX_TEXT_FILE_SIZE  4096
+    int size = rini_save_to_buffer(data, NULL, 0);
+    char *text = (char *)RINI_MALLOC(size + 1);
 
-    // Verify required data size is smaller than memory buffer size
-    // NOTE: We add 64 extra possible characters by entry line
-    int requiredSize = 0;
-    for (unsigned int i = 0; i < data.count; i++) requiredSize += ((int)strlen(data.values[i].key) + (int)strlen(data.values[i].text) + (int)strlen(data.values[i].desc) + 64);
-    if (requiredSize > RINI_MAX_TEXT_FILE_SIZE) RINI_LOG("WARNING: Required data.ini size is bigger than max supported memory size, increase RINI_MAX_TEXT_FILE_SIZE\n");
+    if (text != NULL) rini_save_to_buffer(data, text, size + 1);
 
-    // NOTE: Using a static buffer to avoid de-allocation requirement on user side
-    static char text[RINI_MAX_TEXT_FILE_SIZE] = { 0 };
-    memset(text, 0, RINI_MAX_TEXT_FILE_SIZE);
-    int offset = 0;
+    return text;
+}
 
-    char valuestr[RINI_MAX_TEXT_FILE_SIZE + 2] = { 0 }; // Useful for text processing, adding quotation marks if required
+// Save data to caller buffer ('\0' EOL), returns required size
+// NOTE: Required size does not include '\0' terminator, buffer is only written if
+// buffer_size is big enough (required size + 1), no static state used (reentrant)
+int rini_save_to_buffer(rini_data data, char *buffer, int buffer_size)
+{
+    int size = rini_write_values(data, NULL);
 
-    for (unsigned int i = 0; i < data.count; i++)
+    if ((buffer != NULL) && (buffer_size > size))
     {
-        if ((data.values[i].key[0] == '\0') && (data.values[i].text[0] == RINI_LINE_COMMENT_DELIMITER))
-        {
-            if (data.values[i].desc[0] != '\0') offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%c %s\n", RINI_LINE_COMMENT_DELIMITER, data.values[i].desc);
-            else offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%c\n", RINI_LINE_COMMENT_DELIMITER);
-        }
-        else
-        {
-            memset(valuestr, 0, RINI_MAX_TEXT_FILE_SIZE + 2);
-#if RINI_USE_TEXT_QUOTATION_MARKS
-            // Add quotation marks if required
-            if (data.values[i].is_text) snprintf(valuestr, RINI_MAX_TEXT_FILE_SIZE + 2, "%c%s%c", RINI_VALUE_QUOTATION_MARKS, data.values[i].text, RINI_VALUE_QUOTATION_MARKS);
-#else
-            snprintf(valuestr, RINI_MAX_TEXT_FILE_SIZE + 2, "%s", data.values[i].text);
-#endif
-            offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%-*s %c %-*s %c %s\n", RINI_KEY_SPACING, data.values[i].key, RINI_VALUE_DELIMITER,
-                    RINI_VALUE_SPACING, data.values[i].is_text? valuestr : data.values[i].text,
-                    RINI_DESCRIPTION_DELIMITER, data.values[i].desc);
-        }
+        rini_write_values(data, buffer);
+        buffer[size] = '\0';
     }
 
-    return text;
+    return size;
+}
+
+// Unload text buffer returned by rini_save_to_memory()
+void rini_unload_text(char *text)
+{
+    RINI_FREE(text);
 }
 
 // Unload data
@@ -538,25 +623,118 @@ void rini_unload(rini_data *data)
 {
     RINI_FREE(data->values);
 
+    RINI_FREE(data->sections);
+
+    while (data->pool != NULL)
+    {
+        rini_pool_block *next = data->pool->next;
+        RINI_FREE(data->pool);
+        data->pool = next;
+    }
+
+    if (data->index != NULL)
+    {
+        RINI_FREE(data->index->slots);
+        RINI_FREE(data->index);
+    }
+
+    data->index = NULL;
+    data->sections = NULL;
+    data->section_count = 0;
     data->values = NULL;
     data->count = 0;
     data->capacity = 0;
 }
 
-// Get value for provided key, returns 0 if not found or not valid
-int rini_get_value(rini_data data, const char *key)
+// Init parser for text buffer (caller owned)
+rini_parser rini_parser_init(const char *buffer, unsigned int size)
 {
-    int value = 0;
+    rini_parser parser = { 0 };
 
-    for (unsigned int i = 0; i < data.count; i++)
+    parser.buffer = buffer;
+    parser.size = (buffer != NULL)? size : 0;
+
+    return parser;
+}
+
+// Parse next entry, returns false when buffer end reached
+// NOTE: Comment lines, section lines and empty lines are skipped
+bool rini_parse_next(rini_parser *parser, rini_entry *entry)
+{
+    while (parser->offset < parser->size)
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
+        const char *line = parser->buffer + parser->offset;
+        unsigned int remaining = parser->size - parser->offset;
+
+        // Get line length, next line starts after line break
+        const char *line_end = (const char *)memchr(line, '\n', remaining);
+        unsigned int len = (line_end != NULL)? (unsigned int)(line_end - line) : remaining;
+
+        parser->offset += (line_end != NULL)? (len + 1) : len;
+        parser->line++;
+
+        while ((len > 0) && (line[len - 1] == '\r')) len--;   // Remove line break carriage returns
+
+        // Skip commented lines and empty lines
+        if ((len == 0) || (line[0] == '\0') || (line[0] == RINI_LINE_COMMENT_DELIMITER)) continue;
+
+        // Section line, following entries belong to this section
+        if (line[0] == RINI_LINE_SECTION_DELIMITER)
         {
-            value = rini_text_to_int(data.values[i].text);
-            break;
+            unsigned int name_start = 1;
+            unsigned int name_end = 1;
+
+            while ((name_end < len) && (line[name_end] != ']')) name_end++;
+            while ((name_start < name_end) && (line[name_start] == ' ')) name_start++;
+            while ((name_end > name_start) && (line[name_end - 1] == ' ')) name_end--;
+
+            parser->section.ptr = line + name_start;
+            parser->section.len = name_end - name_start;
+
+            continue;
         }
+
+        rini_parse_line(line, len, entry);
+        entry->section = parser->section;
+
+        return true;
     }
 
+    return false;
+}
+
+// Copy slice text to NULL terminated buffer (truncated if required), returns copied length
+int rini_slice_copy(rini_slice slice, char *dst, int dst_size)
+{
+    if ((dst == NULL) || (dst_size <= 0)) return 0;
+
+    int len = ((int)slice.len < (dst_size - 1))? (int)slice.len : (dst_size - 1);
+
+    if (len > 0) memcpy(dst, slice.ptr, len);
+    dst[len] = '\0';
+
+    return len;
+}
+
+// Check if slice text is equal to NULL terminated text
+bool rini_slice_equals(rini_slice slice, const char *text)
+{
+    if (text == NULL) return false;
+
+    unsigned int i = 0;
+    for (; (i < slice.len) && (text[i] != '\0'); i++) if (slice.ptr[i] != text[i]) return false;
+
+    return ((i == slice.len) && (text[i] == '\0'));
+}
+
+// Get value for provided key, returns 0 if not found or not valid
+int rini_get_value(rini_data data, const char *key)
+{
+    int value = 0;
+    int index = rini_find_value(data, 0, key);
+
+    if (index >= 0) value = rini_value_to_int(&data.values[index]);
+
     return value;
 }
 
@@ -564,16 +742,10 @@ int rini_get_value(rini_data data, const char *key)
 int rini_get_value_fallback(rini_data data, const char *key, int fallback)
 {
     int value = fallback;
+    int index = rini_find_value(data, 0, key);
 
-    for (unsigned int i = 0; i < data.count; i++)
-    {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
-        {
-            // TODO: Detect if conversion fails...
-            value = rini_text_to_int(data.values[i].text);
-            break;
-        }
-    }
+    // TODO: Detect if conversion fails...
+    if (index >= 0) value = rini_value_to_int(&data.values[index]);
 
     return value;
 }
@@ -582,15 +754,9 @@ int rini_get_value_fallback(rini_data data, const char *key, int fallback)
 const char *rini_get_value_text(rini_data data, const char *key)
 {
     const char *text = NULL;
+    int index = rini_find_value(data, 0, key);
 
-    for (unsigned int i = 0; i < data.count; i++)
-    {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
-        {
-            text = data.values[i].text;
-            break;
-        }
-    }
+    if (index >= 0) text = data.values[index].text;
 
     return text;
 }
@@ -599,32 +765,91 @@ const char *rini_get_value_text(rini_data data, const char *key)
 RINIAPI const char *rini_get_value_text_fallback(rini_data data, const char *key, const char *fallback)
 {
     const char *text = fallback;
+    int index = rini_find_value(data, 0, key);
 
-    for (unsigned int i = 0; i < data.count; i++)
+    if (index >= 0) text = data.values[index].text;
+
+    return text;
+}
+
+// Get value type (rini_value_type) for provided key, returns -1 if not found
+int rini_get_value_type(rini_data data, const char *key)
+{
+    int type = -1;
+    int index = rini_find_value(data, 0, key);
+
+    if (index >= 0) type = data.values[index].type;
+
+    return type;
+}
+
+// Get value float for provided key, returns 0.0f if not found
+// NOTE: Text values are converted (leading number), integer values casted
+float rini_get_value_float(rini_data data, const char *key)
+{
+    float value = 0.0f;
+    int index = rini_find_value(data, 0, key);
+
+    if (index >= 0)
+    {
+        const rini_value *found = &data.values[index];
+
+        if (found->type == RINI_TYPE_FLOAT) value = found->typed.float_value;
+        else if ((found->type == RINI_TYPE_INT) || (found->type == RINI_TYPE_BOOL)) value = (float)found->typed.int_value;
+        else value = rini_text_to_float(found->text, found->text_len, NULL, NULL);
+    }
+
+    return value;
+}
+
+// Get value list items count for provided key (1 for not list values, 0 if not found)
+int rini_get_value_list_count(rini_data data, const char *key)
+{
+    int count = 0;
+    int index = rini_find_value(data, 0, key);
+
+    if (index >= 0) count = (data.values[index].type == RINI_TYPE_STRING_LIST)? (int)data.values[index].typed.list_count : 1;
+
+    return count;
+}
+
+// Get value list item for provided key, spaces trimmed (empty slice if not found)
+// NOTE: Slice points into value text, valid until value is set again or data unloaded
+rini_slice rini_get_value_list_item(rini_data data, const char *key, int index)
+{
+    rini_slice item = { 0 };
+    int value_index = rini_find_value(data, 0, key);
+
+    if ((value_index >= 0) && (index >= 0))
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
+        const rini_value *value = &data.values[value_index];
+        unsigned int start = 0;
+
+        // Find item start, skipping previous items
+        for (unsigned int i = 0; (i < value->text_len) && (index > 0); i++) if (value->text[i] == RINI_VALUE_LIST_DELIMITER) { start = i + 1; index--; }
+
+        if (index == 0)
         {
-            text = data.values[i].text;
-            break;
+            unsigned int end = start;
+            while ((end < value->text_len) && (value->text[end] != RINI_VALUE_LIST_DELIMITER)) end++;
+            while ((start < end) && (value->text[start] == ' ')) start++;
+            while ((end > start) && (value->text[end - 1] == ' ')) end--;
+
+            item.ptr = value->text + start;
+            item.len = end - start;
         }
     }
 
-    return text;
+    return item;
 }
 
 // Get description for string id
 const char *rini_get_value_description(rini_data data, const char *key)
 {
     const char *desc = NULL;
+    int index = rini_find_value(data, 0, key);
 
-    for (unsigned int i = 0; i < data.count; i++)
-    {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
-        {
-            desc = data.values[i].desc;
-            break;
-        }
-    }
+    if (index >= 0) desc = data.values[index].desc;
 
     return desc;
 }
@@ -635,7 +860,7 @@ int rini_set_comment_line(rini_data *data, const char *comment)
     int result = -1;
     char text[2] = { RINI_LINE_COMMENT_DELIMITER, '\0' };
 
-    result = rini_set_value_text(data, NULL, text, comment);
+    result = rini_set_value_ex(data, 0, NULL, text, comment, true);
 
     return result;
 }
@@ -644,201 +869,838 @@ int rini_set_comment_line(rini_data *data, const char *comment)
 int rini_set_value(rini_data *data, const char *key, int value, const char *desc)
 {
     int result = -1;
-    char value_text[RINI_MAX_TEXT_SIZE] = { 0 };
-
-    snprintf(value_text, RINI_MAX_TEXT_SIZE, "%i", value);
+    char value_text[16] = { 0 };
 
-    result = rini_set_value_text(data, key, value_text, desc);
+    snprintf(value_text, 16, "%i", value);
 
-    data->values[data->count - 1].is_text = false;
+    result = rini_set_value_ex(data, 0, key, value_text, desc, false);
 
     return result;
 }
 
+// Set value float and description for existing key or create a new entry
+// NOTE: Value saved with decimal point, so it is loaded back as float
+int rini_set_value_float(rini_data *data, const char *key, float value, const char *desc)
+{
+    char value_text[32] = { 0 };
+    int length = snprintf(value_text, 32, "%g", value);
+
+    // NOTE: snprintf() uses current locale decimal point, rini always expects '.'
+    for (int i = 0; i < length; i++) if (value_text[i] == ',') value_text[i] = '.';
+    if ((length > 0) && (length < 30) && (strpbrk(value_text, ".eEn") == NULL)) { value_text[length] = '.'; value_text[length + 1] = '0'; }
+
+    return rini_set_value_ex(data, 0, key, value_text, desc, false);
+}
+
 // Set value text and description for existing key or create a new entry
 // NOTE: When setting a text value, if id does not exist, a new entry is automatically created
 int rini_set_value_text(rini_data *data, const char *key, const char *text, const char *desc)
+{
+    return rini_set_value_ex(data, 0, key, text, desc, true);
+}
+
+// Set value description for existing key
+// WARNING: Key must exist to add description, if a description exists, it is updated
+int rini_set_value_description(rini_data *data, const char *key, const char *desc)
+{
+    int result = 1;
+    int index = rini_find_value(*data, 0, key);
+
+    if (index >= 0)
+    {
+        rini_value *value = &data->values[index];
+
+        if (rini_set_string(data, &value->desc, &value->desc_len, desc, (desc != NULL)? (unsigned int)strlen(desc) : 0)) result = 0;
+        else result = -1;
+    }
+
+    return result;
+}
+
+// Get section value int for provided key, returns 0 if not found or not valid
+int rini_get_section_value(rini_data data, const char *section, const char *key)
+{
+    int value = 0;
+    int index = rini_find_value(data, rini_find_section(data, section, (section != NULL)? (unsigned int)strlen(section) : 0), key);
+
+    if (index >= 0) value = rini_value_to_int(&data.values[index]);
+
+    return value;
+}
+
+// Get section value text for provided key, returns NULL if not found
+const char *rini_get_section_value_text(rini_data data, const char *section, const char *key)
+{
+    const char *text = NULL;
+    int index = rini_find_value(data, rini_find_section(data, section, (section != NULL)? (unsigned int)strlen(section) : 0), key);
+
+    if (index >= 0) text = data.values[index].text;
+
+    return text;
+}
+
+// Set section value and description for existing key or create a new entry (and section)
+int rini_set_section_value(rini_data *data, const char *section, const char *key, int value, const char *desc)
+{
+    char value_text[16] = { 0 };
+    int section_index = rini_add_section(data, section, (section != NULL)? (unsigned int)strlen(section) : 0);
+
+    if (section_index < 0) return -1;
+
+    snprintf(value_text, 16, "%i", value);
+
+    return rini_set_value_ex(data, section_index, key, value_text, desc, false);
+}
+
+// Set section value text and description for existing key or create a new entry (and section)
+int rini_set_section_value_text(rini_data *data, const char *section, const char *key, const char *text, const char *desc)
+{
+    int section_index = rini_add_section(data, section, (section != NULL)? (unsigned int)strlen(section) : 0);
+
+    if (section_index < 0) return -1;
+
+    return rini_set_value_ex(data, section_index, key, text, desc, true);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+// Parse entry slices from a buffer line containing key-value-(description)
+// NOTE: Line length does not include line break
+static void rini_parse_line(const char *line, unsigned int len, rini_entry *entry)
+{
+    // Expected line structure:
+    // [key][spaces?][delimiter?][spaces?][quot-mark?][textValue][quot-mark?][spaces?][[;][#]description?]
+    // We need to skip spaces, check for delimiter (if required), skip spaces, and get text value
+    unsigned int i = 0;
+
+    memset(entry, 0, sizeof(rini_entry));
+
+    while ((i < len) && (line[i] != ' ') && (line[i] != RINI_VALUE_DELIMITER)) i++;  // Skip key identifier
+    entry->key.ptr = line;
+    entry->key.len = i;
+
+    while ((i < len) && (line[i] == ' ')) i++;  // Skip line spaces before text value or delimiter
+
+#if defined(RINI_VALUE_DELIMITER)
+    if ((i < len) && (line[i] == RINI_VALUE_DELIMITER))
+    {
+        i++;    // Skip delimiter
+
+        while ((i < len) && (line[i] == ' ')) i++;  // Skip line spaces before text value
+    }
+#endif
+
+    // Now i should be pointing to the start of value
+    unsigned int value_start = i;
+    unsigned int value_end = len;
+    unsigned int desc_search = i;
+
+#if RINI_USE_TEXT_QUOTATION_MARKS
+    if ((i < len) && (line[i] == RINI_VALUE_QUOTATION_MARKS))
+    {
+        // Find ending quotation-mark, description delimiter is not considered inside text
+        unsigned int quote_end = i + 1;
+        while ((quote_end < len) && (line[quote_end] != RINI_VALUE_QUOTATION_MARKS)) quote_end++;
+
+        entry->is_text = true;
+        value_start = i + 1;
+
+        if (quote_end < len)
+        {
+            value_end = quote_end;
+            desc_search = quote_end + 1;
+        }
+        else desc_search = value_start;     // No ending quotation-mark, text up to description
+    }
+#endif
+
+    // Scan text looking for text-value description (if used)
+    unsigned int desc_pos = len;
+#if defined(RINI_DESCRIPTION_DELIMITER)
+    for (unsigned int d = desc_search; d < len; d++)
+    {
+        if (line[d] == RINI_DESCRIPTION_DELIMITER) { desc_pos = d; break; }
+    }
+#endif
+
+    if (desc_search == value_start)
+    {
+        // Value not delimited by quotation-marks, remove spaces before description
+        value_end = desc_pos;
+        while ((value_end > value_start) && ((line[value_end - 1] == ' ') || (line[value_end - 1] == '\t') || (line[value_end - 1] == '\r'))) value_end--;
+    }
+
+    entry->text.ptr = line + value_start;
+    entry->text.len = value_end - value_start;
+
+    if (desc_pos < len)
+    {
+        desc_pos++;     // Skip delimiter and following spaces
+        while ((desc_pos < len) && (line[desc_pos] == ' ')) desc_pos++;
+
+        unsigned int desc_end = len;
+        while ((desc_end > desc_pos) && ((line[desc_end - 1] == ' ') || (line[desc_end - 1] == '\t') || (line[desc_end - 1] == '\r'))) desc_end--;
+
+        entry->desc.ptr = line + desc_pos;
+        entry->desc.len = desc_end - desc_pos;
+    }
+
+    entry->type = rini_parse_typed(entry->text.ptr, entry->text.len, entry->is_text, &entry->typed);
+}
+
+// Load values from text buffer, single pass
+// NOTE: Values strings copied to data strings pool, no size limit
+static void rini_load_values(rini_data *data, const char *buffer, unsigned int size)
+{
+    rini_parser parser = rini_parser_init(buffer, size);
+    rini_entry entry = { 0 };
+
+    // NOTE: Parsed strings (plus terminators) never exceed buffer size + 1,
+    // a single pool block is enough for all values loaded
+    rini_pool_add_block(data, size + 1, false);
+
+    const char *section_name = NULL;
+    int section = 0;
+
+    while (rini_parse_next(&parser, &entry))
+    {
+        // NOTE: Entries without key (line starting with spaces) can not be accessed, not loaded
+        if (entry.key.len == 0) continue;
+
+        // NOTE: Section added once, when first entry of a section line is parsed
+        if (entry.section.ptr != section_name)
+        {
+            section = rini_add_section(data, entry.section.ptr, entry.section.len);
+            section_name = entry.section.ptr;
+            if (section < 0) break;
+        }
+
+        if (!rini_reserve_values(data, data->count + 1)) break;
+
+        rini_value *value = &data->values[data->count];
+
+        value->key = rini_pool_store(data, entry.key.ptr, entry.key.len);
+        value->text = rini_pool_store(data, entry.text.ptr, entry.text.len);
+        value->desc = rini_pool_store(data, entry.desc.ptr, entry.desc.len);
+        if ((value->key == NULL) || (value->text == NULL) || (value->desc == NULL)) break;
+
+        value->key_len = entry.key.len;
+        value->text_len = entry.text.len;
+        value->desc_len = entry.desc.len;
+        value->section = (unsigned int)section;
+        value->is_text = entry.is_text;
+        value->type = entry.type;
+        value->typed = entry.typed;
+
+        data->count++;
+    }
+
+#if !defined(RINI_NO_HASH_INDEX)
+    // NOTE: Keys hash index built once all values are loaded, lookups use it as is
+    if ((data->index != NULL) && (data->count >= RINI_HASH_INDEX_MIN_VALUES)) rini_index_update(*data);
+#endif
+}
+
+// Set value text, description and type for existing key or create a new entry
+// NOTE: Values array grows if required, strings stored in data strings pool
+static int rini_set_value_ex(rini_data *data, int section, const char *key, const char *text, const char *desc, bool is_text)
 {
     int result = -1;
 
     //if ((text == NULL) || (text[0] == '\0')) return result; // WARNING: It avoids empty text
 
-    if (key != NULL)
+#if !defined(RINI_NO_HASH_INDEX)
+    // NOTE: Data created without rini_load() has no index, created on first set
+    if (data->index == NULL) data->index = (rini_index *)RINI_CALLOC(1, sizeof(rini_index));
+#endif
+
+    // Try to find key and update text and description
+    int index = rini_find_value(*data, section, key);
+
+    unsigned int text_len = (text != NULL)? (unsigned int)strlen(text) : 0;
+    unsigned int desc_len = (desc != NULL)? (unsigned int)strlen(desc) : 0;
+
+    if (index >= 0)
     {
-        // Try to find key and update text and description
-        for (unsigned int i = 0; i < data->count; i++)
-        {
-            if (strcmp(key, data->values[i].key) == 0) // Key found
-            {
-                memset(data->values[i].text, 0, RINI_MAX_TEXT_SIZE);
-                memcpy(data->values[i].text, text, strlen(text));
+        rini_value *value = &data->values[index];
 
-                memset(data->values[i].desc, 0, RINI_MAX_DESC_SIZE);
-                if (desc != NULL) memcpy(data->values[i].desc, desc, strlen(desc));
-                result = 0;
-                break;
-            }
+        if (rini_set_string(data, &value->text, &value->text_len, text, text_len) &&
+            rini_set_string(data, &value->desc, &value->desc_len, desc, desc_len))
+        {
+            value->is_text = is_text;
+            value->type = rini_parse_typed(value->text, value->text_len, is_text, &value->typed);
+            result = 0;
         }
+        else result = 1;
     }
 
-    // Key not found, we add a new entry if possible
-    if (result == -1)
+    // Key not found, we add a new entry
+    if ((result == -1) && rini_reserve_values(data, data->count + 1))
     {
-        if (data->count < data->capacity)
+        rini_value *value = &data->values[data->count];
+        memset(value, 0, sizeof(rini_value));
+
+        // NOTE: Supporting comment line entries
+        if ((key == NULL) && (text != NULL) && (text[0] == RINI_LINE_COMMENT_DELIMITER))
         {
-            // NOTE: Supporting comment line entries
-            if ((key == NULL) && (text[0] == RINI_LINE_COMMENT_DELIMITER))
-            {
-                data->values[data->count].key[0] = '\0';
-                data->values[data->count].text[0] = RINI_LINE_COMMENT_DELIMITER;
-                if (desc != NULL) for (int i = 0; (i < RINI_MAX_DESC_SIZE) && (desc[i] != '\0'); i++)
-                    data->values[data->count].desc[i] = desc[i];
-                else data->values[data->count].desc[0] = '\0';
-            }
-            else
-            {
-                // NOTE: We do a manual copy to avoid possible overflows on input data
-                for (int i = 0; (i < RINI_MAX_KEY_SIZE) && (key[i] != '\0'); i++) data->values[data->count].key[i] = key[i];
-                for (int i = 0; (i < RINI_MAX_TEXT_SIZE) && (text[i] != '\0'); i++) data->values[data->count].text[i] = text[i];
-                if (desc != NULL) for (int i = 0; (i < RINI_MAX_DESC_SIZE) && (desc[i] != '\0'); i++) data->values[data->count].desc[i] = desc[i];
-            }
+            text_len = 1;
+            is_text = true;
+        }
+
+        unsigned int key_len = (key != NULL)? (unsigned int)strlen(key) : 0;
+
+        value->key = rini_pool_store(data, key, key_len);
+        value->text = rini_pool_store(data, text, text_len);
+        value->desc = rini_pool_store(data, desc, desc_len);
+
+        if ((value->key != NULL) && (value->text != NULL) && (value->desc != NULL))
+        {
+            value->key_len = key_len;
+            value->text_len = text_len;
+            value->desc_len = desc_len;
+            value->section = (unsigned int)section;
+            value->is_text = is_text;
+            value->type = rini_parse_typed(value->text, value->text_len, is_text, &value->typed);
 
-            data->values[data->count].is_text = true;
             data->count++;
             result = 0;
+
+#if !defined(RINI_NO_HASH_INDEX)
+            if ((data->index != NULL) && (data->count >= RINI_HASH_INDEX_MIN_VALUES)) rini_index_update(*data);
+#endif
         }
     }
 
     return result;
 }
 
-// Set value description for existing key
-// WARNING: Key must exist to add description, if a description exists, it is updated
-int rini_set_value_description(rini_data *data, const char *key, const char *desc)
+// Add strings pool block
+// NOTE: Dedicated blocks (big strings) are linked after current block, keeping its free space available
+static rini_pool_block *rini_pool_add_block(rini_data *data, unsigned int size, bool dedicated)
 {
-    int result = 1;
+    rini_pool_block *block = (rini_pool_block *)RINI_MALLOC(sizeof(rini_pool_block) + size);
 
-    for (unsigned int i = 0; i < data->count; i++)
+    if (block != NULL)
     {
-        if (strcmp(key, data->values[i].key) == 0) // Key found
+        block->size = size;
+        block->used = 0;
+
+        if (dedicated && (data->pool != NULL))
         {
-            memset(data->values[i].desc, 0, RINI_MAX_DESC_SIZE);
-            if (desc != NULL) memcpy(data->values[i].desc, desc, strlen(desc));
-            result = 0;
-            break;
+            block->next = data->pool->next;
+            data->pool->next = block;
+        }
+        else
+        {
+            block->next = data->pool;
+            data->pool = block;
         }
     }
 
-    return result;
+    return block;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Declaration
-//----------------------------------------------------------------------------------
-// Get string id from a buffer line containing id-value pair
-static int rini_read_key(const char *buffer, char *key)
+// Store string in pool, returns NULL terminated copy, NULL if it can not be allocated
+// NOTE: Empty strings are not stored, a constant empty string is returned
+static const char *rini_pool_store(rini_data *data, const char *text, unsigned int len)
 {
-    int len = 0;
-    while ((buffer[len] != '\0') && (buffer[len] != ' ') && (buffer[len] != RINI_VALUE_DELIMITER)) len++;    // Skip keyentifier
+    if ((text == NULL) || (len == 0)) return "";
 
-    memcpy(key, buffer, len);
+    rini_pool_block *block = data->pool;
 
-    return len;
+    if ((block == NULL) || ((block->size - block->used) < (len + 1)))
+    {
+        bool dedicated = ((len + 1) > RINI_POOL_BLOCK_SIZE/4);
+
+        block = rini_pool_add_block(data, dedicated? (len + 1) : RINI_POOL_BLOCK_SIZE, dedicated);
+        if (block == NULL) return NULL;
+    }
+
+    char *string = block->data + block->used;
+
+    memcpy(string, text, len);
+    string[len] = '\0';
+    block->used += (len + 1);
+
+    return string;
 }
 
-// Get string-value from a buffer line containing id-value pair
-static int rini_read_value_text(const char *buffer, char *text, char *desc, bool *is_text)
+// Set value string, reusing its storage if new string fits
+// NOTE: Previous storage is not released until rini_unload(), strings are never moved
+static bool rini_set_string(rini_data *data, const char **string, unsigned int *string_len, const char *text, unsigned int len)
 {
-    char *buffer_ptr = (char *)buffer;
+    if ((len > 0) && (len <= *string_len))
+    {
+        // WARNING: Pool strings are only written by rini, const just for users
+        char *stored = (char *)*string;
 
-    // Expected line structure:
-    // [key][spaces?][delimiter?][spaces?][quot-mark?][textValue][quot-mark?][spaces?][[;][#]description?]
-    // We need to skip spaces, check for delimiter (if required), skip spaces, and get text value
+        memcpy(stored, text, len);
+        memset(stored + len, 0, *string_len - len + 1);
+    }
+    else
+    {
+        const char *stored = rini_pool_store(data, text, len);
+        if (stored == NULL) return false;
 
-    while ((buffer_ptr[0] != '\0') && (buffer_ptr[0] != ' ')) buffer_ptr++; // Skip keyentifier
+        *string = stored;
+    }
 
-    while ((buffer_ptr[0] != '\0') && (buffer_ptr[0] == ' ')) buffer_ptr++; // Skip line spaces before text value or delimiter
+    *string_len = len;
 
-#if defined(RINI_VALUE_DELIMITER)
-    if (buffer_ptr[0] == RINI_VALUE_DELIMITER)
+    return true;
+}
+
+// Reserve values capacity, growing geometrically
+// NOTE: New values are zero initialized
+static bool rini_reserve_values(rini_data *data, unsigned int count)
+{
+    if (count <= data->capacity) return true;
+
+    unsigned int capacity = (data->capacity > 0)? data->capacity : RINI_INITIAL_VALUE_CAPACITY;
+    while (capacity < count) capacity *= 2;
+
+    rini_value *values = (rini_value *)RINI_REALLOC(data->values, capacity*sizeof(rini_value));
+    if (values == NULL) return false;
+
+    memset(values + data->capacity, 0, (capacity - data->capacity)*sizeof(rini_value));
+
+    data->values = values;
+    data->capacity = capacity;
+
+    return true;
+}
+
+// Write value line to buffer (if provided), returns line length
+// NOTE: Same format as rini_save(): [key][spacing] [delimiter] [value][spacing] [desc-delimiter] [desc]\n
+static int rini_write_value_line(const rini_value *value, char *buffer)
+{
+    int length = 0;
+
+    if ((value->key[0] == '\0') && (value->text[0] == RINI_LINE_COMMENT_DELIMITER))
     {
-        buffer_ptr++;       // Skip delimiter
+        char comment[3] = { RINI_LINE_COMMENT_DELIMITER, ' ', '\0' };
 
-        while ((buffer_ptr[0] != '\0') && (buffer_ptr[0] == ' ')) buffer_ptr++; // Skip line spaces before text value
+        length = rini_write_text(buffer, length, comment, (value->desc_len > 0)? 2 : 1, 0);
+        length = rini_write_text(buffer, length, value->desc, (int)value->desc_len, 0);
     }
+    else
+    {
+        char delimiter[4] = { ' ', RINI_VALUE_DELIMITER, ' ', '\0' };
+        char desc_delimiter[4] = { ' ', RINI_DESCRIPTION_DELIMITER, ' ', '\0' };
+        char quote[2] = { RINI_VALUE_QUOTATION_MARKS, '\0' };
+        int text_length = (int)value->text_len;
+
+        length = rini_write_text(buffer, length, value->key, (int)value->key_len, RINI_KEY_SPACING);
+        length = rini_write_text(buffer, length, delimiter, 3, 0);
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        // Add quotation marks if required
+        if (value->is_text)
+        {
+            int value_start = length;
+            length = rini_write_text(buffer, length, quote, 1, 0);
+            length = rini_write_text(buffer, length, value->text, text_length, 0);
+            length = rini_write_text(buffer, length, quote, 1, 0);
+            length = rini_write_text(buffer, length, NULL, 0, RINI_VALUE_SPACING - (length - value_start));
+        }
+        else length = rini_write_text(buffer, length, value->text, text_length, RINI_VALUE_SPACING);
+#else
+        length = rini_write_text(buffer, length, value->text, text_length, RINI_VALUE_SPACING);
 #endif
+        length = rini_write_text(buffer, length, desc_delimiter, 3, 0);
+        length = rini_write_text(buffer, length, value->desc, (int)value->desc_len, 0);
+    }
+
+    length = rini_write_text(buffer, length, "\n", 1, 0);
 
-    // Now buffer_ptr should be pointing to the start of value
+    return length;
+}
 
-    int len = 0;
-    while ((buffer_ptr[len] != '\0') &&
-        (buffer_ptr[len] != '\r') &&
-        (buffer_ptr[len] != '\n')) len++; // Get text-value and description length (to the end of line)
+// Write text to temp file, flush and replace file
+// NOTE: Text written with a single write() call (repeated only on partial writes),
+// rename() replaces atomically on POSIX, MoveFileExA() required on Windows to replace existing file
+static bool rini_write_file_atomic(const char *temp_file_name, const char *file_name, const char *text, int size)
+{
+    bool success = false;
+    int written = 0;
 
-    // Now we got the length from text-value start to end of line
+#if defined(_WIN32)
+    int fd = _open(temp_file_name, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    if (fd < 0) return false;
 
-    int value_len = len;
-    int desc_pos = 0;
-#if defined(RINI_DESCRIPTION_DELIMITER)
-    // Scan text looking for text-value description (if used)
-    for (; desc_pos < len; desc_pos++)
+    while (written < size)
     {
-        if (buffer_ptr[desc_pos] == RINI_DESCRIPTION_DELIMITER)
-        {
-            value_len = desc_pos - 1;
-            while (buffer_ptr[value_len] == ' ') value_len--;
+        int count = _write(fd, text + written, (unsigned int)(size - written));
+        if (count <= 0) break;
+        written += count;
+    }
+
+    success = ((written == size) && (_commit(fd) == 0));
+    _close(fd);
+
+    if (success) success = (MoveFileExA(temp_file_name, file_name, 0x01 | 0x08) != 0);    // MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+#else
+    int fd = open(temp_file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+
+    while (written < size)
+    {
+        int count = (int)write(fd, text + written, (size_t)(size - written));
+        if (count <= 0) break;
+        written += count;
+    }
+
+    success = ((written == size) && (fsync(fd) == 0));
+    close(fd);
+
+    if (success) success = (rename(temp_file_name, file_name) == 0);
+#endif
+
+    if (!success) remove(temp_file_name);
+
+    return success;
+}
+
+// Write text to buffer (if provided), padded with spaces up to spacing, returns new offset
+static int rini_write_text(char *buffer, int offset, const char *text, int length, int spacing)
+{
+    if ((buffer != NULL) && (length > 0)) memcpy(buffer + offset, text, length);
+    offset += length;
+
+    for (; length < spacing; length++)
+    {
+        if (buffer != NULL) buffer[offset] = ' ';
+        offset++;
+    }
+
+    return offset;
+}
+
+// Find value index by section and key, returns -1 if not found
+// NOTE: Keys hash index used if available, linear search otherwise, only section values are checked,
+// data is never modified (index is built on loading and updated on setting)
+static int rini_find_value(rini_data data, int section, const char *key)
+{
+    if ((section < 0) || (key == NULL) || (key[0] == '\0')) return -1;
+
+#if !defined(RINI_NO_HASH_INDEX)
+    // NOTE: Index is only used if up to date, it could not be allocated or data copy could have added values
+    if ((data.index != NULL) && (data.index->slot_count > 0) && (data.index->value_count == data.count))
+    {
+        unsigned int hash = rini_hash_key((unsigned int)section, key);
+        unsigned int mask = data.index->slot_count - 1;
 
-            value_len++;
+        for (unsigned int s = hash & mask; data.index->slots[s].value != 0; s = (s + 1) & mask)
+        {
+            rini_index_slot slot = data.index->slots[s];
+            const rini_value *value = &data.values[slot.value - 1];
 
-            desc_pos++;   // Skip delimiter and following spaces
-            while (buffer_ptr[desc_pos] == ' ') desc_pos++;
-            break;
+            if ((slot.hash == hash) && (value->section == (unsigned int)section) && (strcmp(key, value->key) == 0)) return (int)slot.value - 1;
         }
+
+        return -1;
     }
 #endif
 
-#if RINI_USE_TEXT_QUOTATION_MARKS
-    // Remove starting quotation-mark from text (if being used)
-    if (buffer_ptr[0] == RINI_VALUE_QUOTATION_MARKS)
+    for (unsigned int i = 0; i < data.count; i++)
+    {
+        if ((data.values[i].section == (unsigned int)section) && (strcmp(key, data.values[i].key) == 0)) return (int)i; // Key found
+    }
+
+    return -1;
+}
+
+// Find section index by name, returns -1 if not found
+// NOTE: Empty section name refers to global section (index 0), always available
+static int rini_find_section(rini_data data, const char *name, unsigned int len)
+{
+    if ((name == NULL) || (len == 0)) return 0;
+
+    for (unsigned int i = 1; i < data.section_count; i++)
+    {
+        if ((data.sections[i].name_len == len) && (memcmp(data.sections[i].name, name, len) == 0)) return (int)i;
+    }
+
+    return -1;
+}
+
+// Add section (if not found), returns section index, -1 if it can not be added
+// NOTE: Global section is created along first section, sections are expected to be a few
+static int rini_add_section(rini_data *data, const char *name, unsigned int len)
+{
+    int index = rini_find_section(*data, name, len);
+
+    if (index < 0)
+    {
+        unsigned int count = (data->section_count > 0)? data->section_count : 1;
+        rini_section *sections = (rini_section *)RINI_REALLOC(data->sections, (count + 1)*sizeof(rini_section));
+        if (sections == NULL) return -1;
+
+        data->sections = sections;
+        if (data->section_count == 0) { data->sections[0].name = ""; data->sections[0].name_len = 0; }
+
+        data->sections[count].name = rini_pool_store(data, name, len);
+        data->sections[count].name_len = len;
+        if (data->sections[count].name == NULL) return -1;
+
+        data->section_count = count + 1;
+        index = (int)count;
+    }
+
+    return index;
+}
+
+// Write values lines grouped by section to buffer (if provided), returns length
+// NOTE: Global section values written first, every section written as: [name] + section values
+static int rini_write_values(rini_data data, char *buffer)
+{
+    int length = 0;
+    unsigned int section_count = (data.section_count > 0)? data.section_count : 1;
+
+    for (unsigned int s = 0; s < section_count; s++)
+    {
+        if (s > 0)
+        {
+            char section_start[3] = { '\n', RINI_LINE_SECTION_DELIMITER, '\0' };
+
+            // NOTE: Empty line added before section line, except at file start
+            if (length > 0) length = rini_write_text(buffer, length, section_start, 2, 0);
+            else length = rini_write_text(buffer, length, section_start + 1, 1, 0);
+            length = rini_write_text(buffer, length, data.sections[s].name, (int)data.sections[s].name_len, 0);
+            length = rini_write_text(buffer, length, "]\n", 2, 0);
+        }
+
+        for (unsigned int i = 0; i < data.count; i++)
+        {
+            if (data.values[i].section == s) length += rini_write_value_line(&data.values[i], (buffer != NULL)? (buffer + length) : NULL);
+        }
+    }
+
+    return length;
+}
+
+#if !defined(RINI_NO_HASH_INDEX)
+// Compute section key hash (FNV-1a)
+static unsigned int rini_hash_key(unsigned int section, const char *key)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; key[i] != '\0'; i++)
+    {
+        hash ^= (unsigned char)key[i];
+        hash *= 16777619u;
+    }
+
+    hash ^= section;
+    hash *= 16777619u;
+
+    return hash;
+}
+
+// Update keys hash index with values not indexed yet
+// NOTE: Index is rebuilt if load factor exceeds 0.5, returns false if index can not be allocated
+static bool rini_index_update(rini_data data)
+{
+    rini_index *index = data.index;
+
+    if (index->value_count > data.count) index->value_count = 0;   // Values changed, rebuild index
+
+    if ((index->slot_count == 0) || ((data.count*2) > index->slot_count) || (index->value_count == 0))
     {
-        buffer_ptr++; desc_pos--; len--; value_len--;
+        unsigned int slot_count = 64;
+        while (slot_count < data.count*2) slot_count *= 2;
+
+        if (slot_count != index->slot_count)
+        {
+            rini_index_slot *slots = (rini_index_slot *)RINI_CALLOC(slot_count, sizeof(rini_index_slot));
+            if (slots == NULL) return false;
 
-        // Remove ending quotation-mark from text (if being used)
-        if (buffer_ptr[value_len - 1] == RINI_VALUE_QUOTATION_MARKS) { value_len--; }
+            RINI_FREE(index->slots);
+            index->slots = slots;
+            index->slot_count = slot_count;
+        }
+        else memset(index->slots, 0, slot_count*sizeof(rini_index_slot));
 
-        *is_text = true;
+        index->value_count = 0;
     }
+
+    unsigned int mask = index->slot_count - 1;
+
+    for (unsigned int i = index->value_count; i < data.count; i++)
+    {
+        if (data.values[i].key[0] == '\0') continue;   // Comment lines not indexed
+
+        unsigned int hash = rini_hash_key(data.values[i].section, data.values[i].key);
+        unsigned int s = hash & mask;
+        bool duplicated = false;
+
+        for (; index->slots[s].value != 0; s = (s + 1) & mask)
+        {
+            const rini_value *indexed = &data.values[index->slots[s].value - 1];
+
+            if ((index->slots[s].hash == hash) && (indexed->section == data.values[i].section) &&
+                (strcmp(data.values[i].key, indexed->key) == 0)) { duplicated = true; break; }
+        }
+
+        if (!duplicated)
+        {
+            index->slots[s].hash = hash;
+            index->slots[s].value = i + 1;
+        }
+    }
+
+    index->value_count = data.count;
+
+    return true;
+}
 #endif
 
-    // Clear text buffers to be updated
-    memset(text, 0, RINI_MAX_TEXT_SIZE);
-    memset(desc, 0, RINI_MAX_DESC_SIZE);
+// Parse value typed data from text, returns value type
+// NOTE: Quoted text values are always strings (or string lists), not quoted values
+// are checked for bool, int and float formats, any other text is considered string
+static int rini_parse_typed(const char *text, unsigned int len, bool is_text, rini_typed_value *typed)
+{
+    int type = RINI_TYPE_STRING;
 
-    // Copy value-text and description to provided pointers
-    memcpy(text, buffer_ptr, value_len);
-    memcpy(desc, buffer_ptr + desc_pos, ((len - desc_pos) > (RINI_MAX_DESC_SIZE - 1))? (RINI_MAX_DESC_SIZE - 1) : (len - desc_pos));
+    memset(typed, 0, sizeof(rini_typed_value));
 
-    return len;
+    if (is_text)
+    {
+        unsigned int count = 1;
+        for (unsigned int i = 0; i < len; i++) if (text[i] == RINI_VALUE_LIST_DELIMITER) count++;
+
+        // NOTE: Quoted text is never a number, int value only computed on request (rini_value_to_int())
+        if (count > 1)
+        {
+            type = RINI_TYPE_STRING_LIST;
+            typed->list_count = count;
+        }
+    }
+    else if ((len == 4) && (memcmp(text, "true", 4) == 0)) { type = RINI_TYPE_BOOL; typed->int_value = 1; }
+    else if ((len == 5) && (memcmp(text, "false", 5) == 0)) { type = RINI_TYPE_BOOL; typed->int_value = 0; }
+    else
+    {
+        unsigned int i = ((len > 0) && ((text[0] == '+') || (text[0] == '-')))? 1 : 0;
+        unsigned int digits = i;
+        while ((digits < len) && (text[digits] >= '0') && (text[digits] <= '9')) digits++;
+
+        // NOTE: Numbers out of int/float range are kept as text (int value saturated)
+        if ((digits > i) && (digits == len))
+        {
+            bool overflow = false;
+            typed->int_value = rini_text_to_int(text, len, &overflow);
+
+            if (!overflow) type = RINI_TYPE_INT;
+        }
+        else
+        {
+            unsigned int parsed = 0;
+            bool overflow = false;
+            float value = rini_text_to_float(text, len, &parsed, &overflow);
+
+            if ((digits > i) && (parsed == len) && !overflow)
+            {
+                type = RINI_TYPE_FLOAT;
+                typed->float_value = value;
+            }
+            else typed->int_value = rini_text_to_int(text, len, NULL);
+        }
+    }
+
+    return type;
 }
 
-// Convert text to int value (if possible), same as atoi()
-static int rini_text_to_int(const char *text)
+// Get value as int, from typed data
+// NOTE: Float values truncated (saturated to int range), strings and string lists converted from text (leading integer)
+static int rini_value_to_int(const rini_value *value)
 {
-    int value = 0;
+    int result = value->typed.int_value;
+
+    if (value->type == RINI_TYPE_FLOAT)
+    {
+        if (value->typed.float_value != value->typed.float_value) result = 0;  // NaN
+        else if (value->typed.float_value >= (float)INT_MAX) result = INT_MAX;
+        else if (value->typed.float_value <= (float)INT_MIN) result = INT_MIN;
+        else result = (int)value->typed.float_value;
+    }
+    else if ((value->type == RINI_TYPE_STRING) || (value->type == RINI_TYPE_STRING_LIST)) result = rini_text_to_int(value->text, value->text_len, NULL);
+
+    return result;
+}
+
+// Convert text to int value (if possible), saturated to int range
+// NOTE: Same as atoi() for values in range, overflow reported (if requested)
+static int rini_text_to_int(const char *text, unsigned int len, bool *overflow)
+{
+    long long value = 0;
+    long long limit = INT_MAX;
     int sign = 1;
+    unsigned int i = 0;
+    bool saturated = false;
+
+    if ((len > 0) && ((text[0] == '+') || (text[0] == '-')))
+    {
+        if (text[0] == '-') { sign = -1; limit = -(long long)INT_MIN; }
+        i++;
+    }
 
-    if ((text[0] == '+') || (text[0] == '-'))
+    for (; (i < len) && (text[i] >= '0') && (text[i] <= '9'); i++)
     {
-        if (text[0] == '-') sign = -1;
-        text++;
+        value = value*10 + (text[i] - '0');
+        if (value > limit) { value = limit; saturated = true; }
+    }
+
+    if (overflow != NULL) *overflow = saturated;
+
+    return (int)(value*sign);
+}
+
+// Convert text to float value (locale independent), returns parsed length (if requested)
+// NOTE: Supported format: [+-]digits[.digits][(e|E)[+-]digits]
+static float rini_text_to_float(const char *text, unsigned int len, unsigned int *parsed, bool *overflow)
+{
+    double value = 0.0;
+    double sign = 1.0;
+    unsigned int i = 0;
+
+    if ((len > 0) && ((text[0] == '+') || (text[0] == '-')))
+    {
+        if (text[0] == '-') sign = -1.0;
+        i++;
+    }
+
+    for (; (i < len) && (text[i] >= '0') && (text[i] <= '9'); i++) value = value*10.0 + (double)(text[i] - '0');
+
+    if ((i < len) && (text[i] == '.'))
+    {
+        double scale = 0.1;
+        for (i++; (i < len) && (text[i] >= '0') && (text[i] <= '9'); i++, scale *= 0.1) value += scale*(double)(text[i] - '0');
+    }
+
+    if ((i < len) && ((text[i] == 'e') || (text[i] == 'E')))
+    {
+        unsigned int e = i + 1;
+        int exponent_sign = 1;
+        int exponent = 0;
+
+        if ((e < len) && ((text[e] == '+') || (text[e] == '-'))) { if (text[e] == '-') exponent_sign = -1; e++; }
+
+        if ((e < len) && (text[e] >= '0') && (text[e] <= '9'))
+        {
+            for (; (e < len) && (text[e] >= '0') && (text[e] <= '9'); e++) if (exponent < 64) exponent = exponent*10 + (text[e] - '0');
+            for (; exponent > 0; exponent--) value = (exponent_sign > 0)? value*10.0 : value/10.0;
+            i = e;
+        }
     }
 
-    int i = 0;
-    for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+    if (parsed != NULL) *parsed = i;
 
-    //if (strlen(text) != i) // Text starts with numbers but contains some text after that...
+    // NOTE: Values out of float range saturated, reported as overflow (if requested)
+    bool saturated = (value > FLT_MAX);
+    if (saturated) value = FLT_MAX;
+    if (overflow != NULL) *overflow = saturated;
 
-    return value*sign;
+    return (float)(value*sign);
 }
 
 #endif  // RINI_IMPLEMENTATION
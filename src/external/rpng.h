@@ -1,6 +1,6 @@
 /**********************************************************************************************
 *
-*   rpng v1.5 - A simple and easy-to-use library to manage png chunks
+*   rpng v1.6 - A simple and easy-to-use library to manage png chunks
 *
 *   FEATURES:
 *       - Load/Save images from/to raw image data
@@ -31,10 +31,34 @@
 *       #define RPNG_NO_STDIO_WARNING
 *           Skips issuing a compiler warning when RPNG_NO_STDIO is defined.
 *
+*       #define RPNG_NO_SIMD
+*           Disable SSE2/NEON scanline filtering kernels, use only the portable C implementation
+*
+*       #define RPNG_NO_THREADS
+*           Disable multithreaded image data processing, all work is done on the calling thread
+*           NOTE: Threads are not available on web platform unless compiled with pthreads support
+*
+*       #define RPNG_MAX_THREADS
+*           Maximum number of threads used to process image data, actual number depends on CPU cores
+*
+*       #define RPNG_DEFLATE_CHUNK_SIZE
+*           Image data chunk size compressed by every thread, big images are split in chunks compressed
+*           in parallel, using previous chunk data as dictionary (only with RPNG_DEFLATE_IMPLEMENTATION)
+*
+*       #define RPNG_STREAM_IDAT_SIZE
+*           IDAT chunks data size on streaming image saving, compressed data is written to file
+*           every time one IDAT chunk is filled (only with RPNG_DEFLATE_IMPLEMENTATION)
+*
+*       #define RPNG_NO_MMAP
+*           Do not memory map files on image loading, file data is read into a memory buffer
+*           NOTE: Memory mapping is only available on POSIX platforms, Windows always reads files
+*
 *   DEPENDENCIES: libc (C standard library)
 *       stdlib.h        Required for: malloc(), calloc(), free()
 *       string.h        Required for: memcmp(), memcpy()
 *       stdio.h         Required for: FILE, fopen(), fread(), fwrite(), fclose() (only if !RPNG_NO_STDIO)
+*       pthread.h       Required for: pthread_create(), pthread_join() (only if !RPNG_NO_THREADS, Windows uses _beginthreadex())
+*       sys/mman.h      Required for: mmap(), munmap() (only if !RPNG_NO_MMAP, POSIX platforms)
 *
 *       rpng includes internally a copy of sdefl and sinfl libraries by Micha Mettke (@vurtun)
 *       sdelf and sinfl libraries are used for compression and decompression of deflate data streams
@@ -90,6 +114,36 @@
 *       Comment          Miscellaneous comment; conversion from GIF comment
 *
 *   VERSIONS HISTORY:
+*       1.6 (18-Oct-2026) ADDED: SSE2/NEON scanline filtering kernels, define RPNG_NO_SIMD to disable them
+*                         REVIEWED: Scanline filter selection, single pass per filter, no per-byte bounds checks
+*                         FIXED: Filter selection sums not reset between scanlines
+*                         ADDED: Multithreaded scanlines filtering in bands, define RPNG_NO_THREADS to disable it
+*                         ADDED: Parallel image data compression in chunks (requires RPNG_DEFLATE_IMPLEMENTATION)
+*                         FIXED: sinfl failing on empty stored blocks (valid deflate data, i.e. zlib sync flush)
+*                         FIXED: sdefl_bound() too small for uncompressible data, output buffer overflow
+*                         ADDED: CRC32 computation using slicing-by-8, PCLMULQDQ (x86, runtime check) or ARMv8 CRC32
+*                         REVIEWED: Chunks CRC32 computed without joining type and data, no temporary buffers
+*                         REVIEWED: rpng_chunk_check_all_valid(), chunks verified in parallel
+*                         FIXED: rpng_chunk_check_all_valid() comparing CRC32 with wrong byte order
+*                         ADDED: Adler-32 computation using SSE2/NEON, shared by sdefl and sinfl
+*                         ADDED: rpng_chunk_edit_*() transaction API, multiple chunks edits with one file load/save
+*                         REVIEWED: rpng_chunk_write_*() and rpng_chunk_remove*() implemented as single edit transactions
+*                         FIXED: rpng_chunk_write_chroma() writing pHYs chunk type instead of cHRM
+*                         FIXED: rpng_chunk_write_time() year not stored as big endian
+*                         ADDED: rpng_save_stream_*() streaming image saving, bounded memory usage
+*                         ADDED: rpng_load_image_info(), image info loading without image data decoding
+*                         ADDED: rpng_load_image_to_buffer(), image data decoded into provided buffer (+ memory version)
+*                         ADDED: Memory mapped files on image loading (POSIX), define RPNG_NO_MMAP to disable it
+*                         ADDED: SSE2/NEON scanline unfiltering kernels
+*                         REVIEWED: Image data loading, single IDAT inflated from file data, exact size buffers
+*                         REVIEWED: IDAT chunks CRC32 validated one by one, chunks bounds checked
+*                         FIXED: Image data unfiltering using signed bytes (Average/Paeth filters)
+*                         FIXED: sinfl reading/writing out of input/output buffers bounds on corrupted data
+*                         ADDED: rpng_save_image_ex() and rpng_save_stream_begin_ex(), encode profile (+ memory version)
+*                         ADDED: Fast encode profile, fixed Paeth filter and run-length only deflate matching
+*                         ADDED: Max encode profile, scanline filter chosen by compressed size, best of multiple strategies
+*                         ADDED: sdefl deflate blocks splitting (SDEFL_BLK_SPLIT), used by max encode profile
+*
 *       1.5 (28-Aug-2024) ADDED: Support indexed data loading and saving (PLTE, tRNS)
 *                         ADDED: rpng_load_image_indexed() (+ memory version)
 *                         ADDED: rpng_save_image_indexed() (+ memory version)
@@ -132,7 +186,7 @@
 #ifndef RPNG_H
 #define RPNG_H
 
-#define RPNG_VERSION    "1.5"
+#define RPNG_VERSION    "1.6"
 
 // Function specifiers in case library is build/used as a shared library (Windows)
 // NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
@@ -185,8 +239,36 @@
     #define RPNG_MAX_OUTPUT_SIZE    (64*1024*1024)
 #endif
 
+#ifndef RPNG_MAX_THREADS
+    // Maximum number of threads used to process image data
+    #define RPNG_MAX_THREADS        8
+#endif
+#ifndef RPNG_THREAD_BAND_SIZE
+    // Image data size processed by every thread job (scanlines band),
+    // small enough to keep source and filtered scanlines in L2 cache
+    #define RPNG_THREAD_BAND_SIZE   (256*1024)
+#endif
+
+#ifndef RPNG_DEFLATE_CHUNK_SIZE
+    // Image data chunk size compressed by every thread
+    // NOTE: Chunks are compressed using previous 32KB as dictionary, only a small
+    // alignment block (6 bytes) is added between chunks, compression ratio is barely affected
+    #define RPNG_DEFLATE_CHUNK_SIZE (256*1024)
+#endif
+
+#ifndef RPNG_STREAM_IDAT_SIZE
+    // IDAT chunks data size on streaming image saving
+    #define RPNG_STREAM_IDAT_SIZE   (64*1024)
+#endif
+
+#ifndef RPNG_FILTER_TRIAL_CONTEXT
+    // Previous filtered data compressed with every scanline filter candidate (max encode profile),
+    // candidate compressed size considers matches with previous scanlines
+    #define RPNG_FILTER_TRIAL_CONTEXT   (16*1024)
+#endif
+
 #ifndef RPNG_COMPRESSION_LEVEL
-    // Deflate compression level
+    // Deflate compression level (balanced encode profile)
     // NOTE: Default to same as stbiw: 8
     #define RPNG_COMPRESSION_LEVEL   8
 #endif
@@ -197,6 +279,8 @@
 #define RPNG_ERROR_FILE_OPEN         1      // The requested file can not be opened
 #define RPNG_ERROR_PIXEL_FORMAT      2      // Not a supported PNG image format
 #define RPNG_ERROR_MEMORY_ALLOC      3      // Memory could not be allocated for operation
+#define RPNG_ERROR_FILE_WRITE        4      // The file could not be written (or partially written)
+#define RPNG_ERROR_IMAGE_DATA        5      // Image data not valid or not matching image size
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -228,6 +312,22 @@ typedef struct {
     rpng_color *colors;     // Palette colors
 } rpng_palette;
 
+// Image encode profiles, image saving speed vs compression ratio
+// NOTE: Profile is provided on image saving, see rpng_save_image_ex()
+typedef enum {
+    RPNG_ENCODE_BALANCED = 0,   // Best filter chosen for every scanline, deflate level RPNG_COMPRESSION_LEVEL (default)
+    RPNG_ENCODE_FAST,           // Fixed Paeth filter, run-length only deflate matching: previews, intermediate files
+    RPNG_ENCODE_MAX             // Filter trials per scanline, multiple deflate strategies, block splitting: release imagery (slow)
+} rpng_encode_profile;
+
+// Chunks edition transaction
+// NOTE: Edits are queued and applied at once on commit, see rpng_chunk_edit_begin()
+typedef struct rpng_chunk_edit rpng_chunk_edit;
+
+// Streaming image saving state
+// NOTE: Image scanlines are provided incrementally, see rpng_save_stream_begin()
+typedef struct rpng_save_stream rpng_save_stream;
+
 // A minimal PNG only requires: png_signature | rpng_chunk(IHDR) | rpng_chunk(IDAT) | rpng_chunk(IEND)
 
 #ifdef __cplusplus
@@ -254,12 +354,28 @@ RPNGAPI char *rpng_load_image(const char *filename, int *width, int *height, int
 //  - In case image data is not indexed, returns NULL
 RPNGAPI char *rpng_load_image_indexed(const char *filename, int *width, int *height, rpng_palette *palette);
 
+// Load a PNG file image info (IHDR chunk), image data is not loaded
+//  - Color channels and bit depth returned match rpng_load_image() values
+//  - Returns false if file is not a valid PNG or the image format is not supported
+RPNGAPI bool rpng_load_image_info(const char *filename, int *width, int *height, int *color_channels, int *bit_depth);
+
+// Load a PNG file image data into a provided buffer, no memory is allocated for image data
+//  - Data size must be at least: width*height*color_channels*(bit_depth/8), see rpng_load_image_info()
+//  - File is memory mapped when possible, IDAT chunk data is decompressed directly from file data
+//  - Returns loading process result: 0-SUCCESS
+RPNGAPI int rpng_load_image_to_buffer(const char *filename, char *data, int data_size, int *width, int *height, int *color_channels, int *bit_depth);
+
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
 //  - Returns saving process result: 0-SUCCESS
 RPNGAPI int rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth);
 
+// Save a PNG file from image data with requested encode profile (rpng_encode_profile)
+//  - Same as rpng_save_image(), it uses RPNG_ENCODE_BALANCED profile
+//  - Returns saving process result: 0-SUCCESS
+RPNGAPI int rpng_save_image_ex(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth, int encode_profile);
+
 // Save a PNG file from indexed image data (IHDR, PLTE, (tRNS), IDAT, IEND)
 //  - Palette colours are saved as RGB888 in PLTE chunk
 //  - Palette alpha is saved as R8 in tRNS chunk (if required)
@@ -267,11 +383,22 @@ RPNGAPI int rpng_save_image(const char *filename, const char *data, int width, i
 //  - Returns saving process result: 0-SUCCESS
 RPNGAPI int rpng_save_image_indexed(const char *filename, const char *indexed_data, int width, int height, rpng_palette palette);
 
+// Save a PNG file streaming image data, scanlines are provided incrementally (IHDR, IDAT, IEND)
+//  - Image data is filtered and compressed while provided, written to file in fixed size IDAT chunks
+//  - Memory usage does not depend on image size (only on scanline size)
+//  - Requires RPNG_DEFLATE_IMPLEMENTATION (incremental compression)
+RPNGAPI rpng_save_stream *rpng_save_stream_begin(const char *filename, int width, int height, int color_channels, int bit_depth); // Begin streaming saving, writes IHDR
+RPNGAPI rpng_save_stream *rpng_save_stream_begin_ex(const char *filename, int width, int height, int color_channels, int bit_depth, int encode_profile); // Begin streaming saving with encode profile
+RPNGAPI int rpng_save_stream_push_rows(rpng_save_stream *stream, const char *rows, int row_count);   // Push image scanlines (row_count*width*pixel_size bytes)
+RPNGAPI int rpng_save_stream_end(rpng_save_stream *stream);                                         // End streaming saving (stream is freed), returns 0-SUCCESS
+
 // Load and save png data from memory buffer
 // WARNING: Provided buffer is expected to be PNG compliant, ending with IEND chunk
 RPNGAPI char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth); // Load png data from memory buffer
 RPNGAPI char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *height, rpng_palette *palette); // Load indexed png data from memory buffer (8 bpp)
+RPNGAPI int rpng_load_image_to_buffer_from_memory(const char *buffer, int buffer_size, char *data, int data_size, int *width, int *height, int *color_channels, int *bit_depth); // Load png data from memory buffer into provided buffer
 RPNGAPI char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size); // Save png data to memory buffer
+RPNGAPI char *rpng_save_image_to_memory_ex(const char *data, int width, int height, int color_channels, int bit_depth, int encode_profile, int *output_size); // Save png data to memory buffer with encode profile
 RPNGAPI char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int height, rpng_palette palette, int *output_size); // Save indexed data to memory buffer
 
 // Convert indexed image data to RGBA data
@@ -286,6 +413,7 @@ RPNGAPI void rpng_chunk_remove_ancillary(const char *filename);
 RPNGAPI void rpng_chunk_write(const char *filename, rpng_chunk data);                // Write one new chunk after IHDR (any kind)
 
 // Write specific chunks to file
+// NOTE: Every call loads and saves the file, use rpng_chunk_edit_*() functions for multiple edits
 RPNGAPI void rpng_chunk_write_text(const char *filename, char *keyword, char *text);        // Write tEXt chunk
 RPNGAPI void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text);   // Write zTXt chunk, DEFLATE compressed text
 RPNGAPI void rpng_chunk_write_gamma(const char *filename, float gamma);                     // Write gAMA chunk (stored as int, gamma*100000)
@@ -294,6 +422,22 @@ RPNGAPI void rpng_chunk_write_time(const char *filename, short year, char month,
 RPNGAPI void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int pixels_unit_y, bool meters);       // Write pHYs chunk
 RPNGAPI void rpng_chunk_write_chroma(const char *filename, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y); // Write cHRM chunk
 
+// Edit multiple chunks with a single file load and save (transaction)
+// NOTE: Edits are queued and applied in order on commit, new chunks are added after IHDR
+RPNGAPI rpng_chunk_edit *rpng_chunk_edit_begin(const char *filename);                      // Begin chunks edition, file is loaded once
+RPNGAPI int rpng_chunk_edit_commit(rpng_chunk_edit *edit);                                 // Apply queued edits and save file once (edit is freed), returns 0-SUCCESS
+RPNGAPI void rpng_chunk_edit_cancel(rpng_chunk_edit *edit);                                // Discard queued edits (edit is freed)
+RPNGAPI void rpng_chunk_edit_remove(rpng_chunk_edit *edit, const char *chunk_type);        // Queue removing one chunk type
+RPNGAPI void rpng_chunk_edit_remove_ancillary(rpng_chunk_edit *edit);                      // Queue removing all chunks except: IHDR-PLTE-IDAT-IEND
+RPNGAPI void rpng_chunk_edit_write(rpng_chunk_edit *edit, rpng_chunk chunk);               // Queue writing one new chunk (any kind), chunk data is copied
+RPNGAPI void rpng_chunk_edit_write_text(rpng_chunk_edit *edit, char *keyword, char *text);         // Queue writing tEXt chunk
+RPNGAPI void rpng_chunk_edit_write_comp_text(rpng_chunk_edit *edit, char *keyword, char *text);    // Queue writing zTXt chunk, DEFLATE compressed text
+RPNGAPI void rpng_chunk_edit_write_gamma(rpng_chunk_edit *edit, float gamma);                      // Queue writing gAMA chunk (stored as int, gamma*100000)
+RPNGAPI void rpng_chunk_edit_write_srgb(rpng_chunk_edit *edit, char srgb_type);                    // Queue writing sRGB chunk, requires gAMA chunk
+RPNGAPI void rpng_chunk_edit_write_time(rpng_chunk_edit *edit, short year, char month, char day, char hour, char min, char sec);   // Queue writing tIME chunk
+RPNGAPI void rpng_chunk_edit_write_physical_size(rpng_chunk_edit *edit, int pixels_unit_x, int pixels_unit_y, bool meters);        // Queue writing pHYs chunk
+RPNGAPI void rpng_chunk_edit_write_chroma(rpng_chunk_edit *edit, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y); // Queue writing cHRM chunk
+
 // Chunk utilities
 RPNGAPI void rpng_chunk_print_info(const char *filename);                            // Output info about the chunks
 RPNGAPI bool rpng_chunk_check_all_valid(const char *filename);                       // Check chunks CRC is valid
@@ -334,12 +478,151 @@ RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_si
 #if defined(_WIN32) && defined(_MSC_VER)
     #include <io.h>         // Required for: _access() [file_exists()]
 #else
-    #include <unistd.h>     // Required for: access() (POSIX, not C standard) [file_exists()]
+    #include <unistd.h>     // Required for: access(), close() (POSIX, not C standard) [file_exists()]
+#endif
+
+// Memory mapped files on image loading, only available on POSIX platforms
+#if !defined(RPNG_NO_MMAP) && !defined(RPNG_NO_STDIO) && !defined(_WIN32)
+    #define RPNG_MMAP
+    #include <sys/mman.h>   // Required for: mmap(), munmap()
+    #include <sys/stat.h>   // Required for: fstat()
+    #include <fcntl.h>      // Required for: open()
+#endif
+
+// Threads support for image data processing
+#if !defined(RPNG_NO_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>    // Required for: _beginthreadex()
+
+        // NOTE: Avoiding <windows.h> inclusion, it conflicts with some libraries (raylib)
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+
+        #define RPNG_THREADS_WIN32
+    #elif !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+
+        #define RPNG_THREADS_PTHREAD
+    #endif
+#endif
+
+// Parallel image data compression requires internal sdefl implementation
+#if defined(RPNG_DEFLATE_IMPLEMENTATION) && (defined(RPNG_THREADS_WIN32) || defined(RPNG_THREADS_PTHREAD))
+    #define RPNG_DEFLATE_PARALLEL
+#endif
+
+// SIMD support for scanline filtering
+// NOTE: Only baseline instruction sets are used (SSE2 on x86-64, NEON on ARMv7/ARM64),
+// no runtime CPU detection is required for them
+#if !defined(RPNG_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+        #define RPNG_SIMD_SSE2
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+        #define RPNG_SIMD_NEON
+    #endif
+#endif
+
+// CRC32 hardware acceleration
+// NOTE: PCLMULQDQ support is checked at runtime (x86), ARMv8 CRC32 instructions
+// require compiler support enabled (i.e. -march=armv8-a+crc, enabled by default on Apple)
+#if !defined(RPNG_NO_SIMD)
+    #if defined(RPNG_SIMD_SSE2) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+        #include <wmmintrin.h>      // Required for: _mm_clmulepi64_si128()
+        #if defined(_MSC_VER)
+            #include <intrin.h>     // Required for: __cpuid()
+        #endif
+        #define RPNG_CRC32_PCLMUL
+    #elif defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>       // Required for: __crc32d()
+        #define RPNG_CRC32_ARMV8
+    #endif
 #endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+// Parallel job function, called for every job index, thread index allows using per-thread data
+typedef void (*rpng_job_func)(void *data, int index, int thread);
+
+// Parallel job data, every thread processes a subset of the job indices
+typedef struct {
+    rpng_job_func func;         // Job function
+    void *data;                 // Job data, shared by all threads
+    int count;                  // Number of job indices
+    int thread;                 // Thread index, processes indices: thread, thread + thread_count, ...
+    int thread_count;           // Number of threads processing the job
+} rpng_job;
+
+// Chunks CRC32 verification job
+typedef struct {
+    const rpng_chunk *chunks;               // Chunks to verify
+    bool *chunks_valid;                     // Chunks verification result
+} rpng_crc32_check_job;
+
+// Image data filtering job
+typedef struct {
+    const unsigned char *image_data;        // Source image data
+    unsigned char *data_filtered;           // Filtered image data, including filter type byte per scanline
+    const unsigned char *zero_scanline;     // Zeroed scanline, previous scanline for the first image scanline
+    unsigned char *filter_scanlines;        // Filtered candidates scanlines, 4 scanlines per thread
+    int scanline_size;                      // Scanline size in bytes
+    int pixel_size;                         // Pixel size in bytes
+    int height;                             // Image height (number of scanlines)
+    int band_height;                        // Number of scanlines processed by every job
+    int forced_filter_type;                 // Filter type to apply, -1 to choose best filter for every scanline, -2 for filter trials
+    struct sdefl *trial_states;             // Filter trials compressor states, one per thread (only for filter trials)
+    unsigned char *trial_data;              // Filter trials compressed data, one buffer per thread (only for filter trials)
+    int trial_data_size;                    // Filter trials compressed data buffer size
+} rpng_filter_job;
+
+// Image data deflating strategies job (max encode profile)
+typedef struct {
+    const char *image_data;                 // Source image data
+    int width;                              // Image width
+    int height;                             // Image height
+    int pixel_size;                         // Pixel size in bytes
+    const int *filter_types;                // Strategies scanlines filter type
+    const int *levels;                      // Strategies deflate level
+    char **comp_data;                       // Strategies compressed data
+    int *comp_data_size;                    // Strategies compressed data size
+} rpng_deflate_strategy_job;
+
+// Image info, read from IHDR chunk
+typedef struct {
+    int width;                              // Image width
+    int height;                             // Image height
+    int bit_depth;                          // Bit depth per channel
+    int color_type;                         // Pixel format: 0 - Grayscale, 2 - RGB, 3 - Indexed, 4 - GrayAlpha, 6 - RGBA
+    int color_channels;                     // Color channels (indexed data returned as 1 channel)
+    int pixel_size;                         // Pixel size in bytes
+} rpng_image_info;
+
+// Chunks edit operation type
+typedef enum {
+    RPNG_CHUNK_EDIT_WRITE = 0,              // Write new chunk after IHDR
+    RPNG_CHUNK_EDIT_REMOVE,                 // Remove all chunks of one type
+    RPNG_CHUNK_EDIT_REMOVE_ANCILLARY        // Remove all chunks except: IHDR-PLTE-IDAT-IEND (and tRNS if PLTE)
+} rpng_chunk_edit_op_type;
+
+// Chunks edit queued operation
+typedef struct {
+    int type;                               // Operation type (rpng_chunk_edit_op_type)
+    rpng_chunk chunk;                       // Chunk to write (data owned by edit) or chunk type to remove
+} rpng_chunk_edit_op;
+
+// Chunks edition transaction
+struct rpng_chunk_edit {
+    char *filename;                         // File to edit, saved on commit
+    char *file_data;                        // File data, loaded once on edition begin
+    int file_size;                          // File data size
+    int iend_offset;                        // IEND chunk offset in file data
+    bool has_palette;                       // File contains PLTE chunk
+    rpng_chunk_edit_op *ops;                // Queued edit operations
+    int op_count;                           // Queued edit operations count
+    int op_capacity;                        // Queued edit operations capacity
+};
 
 // NOTE: Some chunks strutures are defined for convenience,
 // but only the ones that can be directly serialized to chunk.dataa
@@ -474,20 +757,340 @@ typedef struct {
 //----------------------------------------------------------------------------------
 const unsigned char png_signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a }; // PNG Signature
 
+// CRC32 lookup tables for slicing-by-8, table [0] is the standard CRC32 byte table
+// NOTE: Tables [k] = (tables[k - 1] >> 8) ^ tables[0][tables[k - 1] & 0xff], constant data (thread-safe)
+static const unsigned int crc_tables[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+        0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+    },
+    {
+        0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+        0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+        0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+        0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+        0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+        0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+        0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+        0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+        0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+        0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+        0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+        0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+        0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+        0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+        0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+        0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+        0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+        0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+        0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+        0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+        0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+        0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+        0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+        0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+        0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+        0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+        0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+        0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+        0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+        0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+        0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+        0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72
+    },
+    {
+        0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+        0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+        0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+        0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+        0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+        0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+        0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+        0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+        0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+        0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+        0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+        0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+        0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+        0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+        0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+        0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+        0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+        0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+        0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+        0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+        0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+        0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+        0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+        0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+        0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+        0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+        0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+        0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+        0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+        0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+        0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+        0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED
+    },
+    {
+        0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+        0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+        0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+        0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+        0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+        0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+        0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+        0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+        0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+        0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+        0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+        0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+        0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+        0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+        0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+        0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+        0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+        0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+        0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+        0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+        0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+        0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+        0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+        0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+        0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+        0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+        0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+        0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+        0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+        0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+        0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+        0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1
+    },
+    {
+        0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+        0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+        0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+        0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+        0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+        0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+        0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+        0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+        0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+        0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+        0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+        0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+        0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+        0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+        0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+        0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+        0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+        0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+        0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+        0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+        0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+        0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+        0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+        0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+        0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+        0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+        0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+        0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+        0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+        0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+        0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+        0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C
+    },
+    {
+        0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+        0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+        0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+        0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+        0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+        0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+        0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+        0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+        0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+        0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+        0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+        0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+        0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+        0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+        0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+        0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+        0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+        0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+        0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+        0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+        0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+        0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+        0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+        0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+        0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+        0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+        0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+        0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+        0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+        0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+        0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+        0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC
+    },
+    {
+        0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+        0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+        0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+        0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+        0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+        0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+        0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+        0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+        0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+        0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+        0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+        0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+        0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+        0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+        0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+        0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+        0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+        0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+        0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+        0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+        0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+        0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+        0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+        0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+        0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+        0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+        0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+        0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+        0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+        0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+        0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+        0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30
+    },
+    {
+        0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+        0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+        0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+        0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+        0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+        0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+        0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+        0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+        0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+        0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+        0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+        0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+        0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+        0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+        0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+        0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+        0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+        0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+        0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+        0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+        0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+        0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+        0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+        0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+        0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+        0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+        0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+        0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+        0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+        0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+        0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+        0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6
+    }
+};
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
+// Read image info from PNG data IHDR chunk, returns false if image format is not supported
+static bool rpng_read_image_info(const char *buffer, int buffer_size, rpng_image_info *info);
+// Decode image data from PNG data (IDAT chunks -> output), output size must be width*height*pixel_size
+static int rpng_decode_image_data(const char *buffer, int buffer_size, const rpng_image_info *info, unsigned char *output);
+// Decompress and unfilter image data (IDAT chunk.data -> output), output size must be width*height*pixel_size
+static int rpng_inflate_image_data(const unsigned char *comp_data, int comp_data_size, const rpng_image_info *info, unsigned char *output);
+// Unfilter one scanline with provided filter type, previous scanline must be already unfiltered
+static void rpng_unfilter_scanline(unsigned char *output, const unsigned char *filtered, const unsigned char *prev, int size, int pixel_size, int filter_type);
 // Prefilter and compress image data (image_data -> IDAT chunk.data)
-static char *rpng_inflate_image_data(char *image_data, int image_data_size, int width, int height, int pixel_size);
-// Decompress and unfilter image data (IDAT chunk.data -> image_data)
-static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type);
+static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type, int level);
+// Prefilter and compress image data trying multiple strategies, smallest compressed data is kept (image_data -> IDAT chunk.data)
+static char *rpng_deflate_image_data_max(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size);
+static void rpng_deflate_strategy_job_func(void *data, int index, int thread);  // Prefilter and compress image data with one strategy, parallel job function
+// Get scanlines filter type (-1: best filter for every scanline, -2: filter trials) and deflate level for an encode profile
+static void rpng_get_encode_settings(int encode_profile, int *filter_type, int *level);
+// Filter one scanline with requested filter type, returns the sum of absolute values of outputs (as signed bytes)
+static unsigned int rpng_filter_scanline(unsigned char *output, const unsigned char *row, const unsigned char *prev, int size, int pixel_size, int filter_type);
+// Filter a band of scanlines [y_start..y_end) using thread buffers, choosing best filter for every scanline if required
+static void rpng_filter_scanlines(const rpng_filter_job *job, int y_start, int y_end, int thread);
+// Filter one scanline, choosing best filter if required (forced_filter_type = -1), output includes filter type byte
+static void rpng_filter_row(unsigned char *output, const unsigned char *row, const unsigned char *prev, int scanline_size, int pixel_size, int forced_filter_type, unsigned char *filter_scanlines);
+// Filter one scanline trying all filter types, smallest compressed candidate is chosen, output includes filter type byte
+static void rpng_filter_row_trials(unsigned char *output, const unsigned char *row, const unsigned char *prev, int scanline_size, int pixel_size, int context_size, struct sdefl *sde, unsigned char *trial_data);
+static void rpng_filter_scanlines_job(void *data, int index, int thread);   // Filter one band of scanlines, parallel job function
+static void rpng_crc32_check_job_func(void *data, int index, int thread);   // Verify one chunk CRC32, parallel job function
+
+// Run job function for every index in [0..count) using multiple threads (if available)
+static void rpng_parallel_for(rpng_job_func func, void *data, int count, int thread_count);
+#if defined(RPNG_DEFLATE_PARALLEL)
+// Compress data into a zlib stream, data is split in chunks compressed in parallel (defined after sdefl implementation)
+static char *rpng_deflate_parallel(const unsigned char *data, int size, int level, int *output_size);
+#endif
+static int rpng_get_thread_count(int job_count);   // Get number of threads to use for a number of jobs
 
 // Swap integer from big<->little endian
 static unsigned int swap_endian(unsigned int value);
+static unsigned int read_uint32_be(const char *buffer);                 // Read big endian unsigned int from buffer (no alignment required)
+static void write_uint32_be(char *buffer, unsigned int value);          // Write big endian unsigned int to buffer (no alignment required)
 static unsigned int compute_crc32(unsigned char *buffer, int size);
+static unsigned int compute_chunk_crc32(const char *type, const char *data, int length);   // Compute chunk CRC32 (type + data)
+static unsigned int rpng_crc32_update(unsigned int crc, const unsigned char *buffer, int size);  // Update running CRC32 value (not inverted)
+#if defined(RPNG_CRC32_PCLMUL)
+static bool rpng_crc32_pclmul_supported(void);  // Check CPU support for PCLMULQDQ (CRC32 acceleration)
+#endif
+
+// Chunks edition internal functions
+static void rpng_chunk_edit_push(rpng_chunk_edit *edit, int type, rpng_chunk chunk);   // Queue one edit operation, edit takes ownership of chunk data
+static bool rpng_chunk_edit_keep(const rpng_chunk_edit *edit, const char *chunk_type, int op_index, bool palette_found);  // Check if chunk is kept by queued operations
 
 // Load/save png file data from/to memory buffer
 static char *load_file_to_buffer(const char *filename, int *bytes_read);
+static char *load_file_mapped(const char *filename, int *bytes_read, bool *mapped);    // Map file data (read-only), loaded to buffer if not possible
+static void unload_file_mapped(char *data, int size, bool mapped);                     // Unmap/unload file data
+static int get_png_size_from_memory(const char *buffer);                               // Get PNG data size, up to IEND chunk end
 static int save_file_from_buffer(const char *filename, void *data, int bytesToWrite);
 static bool file_exists(const char *filename);
 
@@ -525,6 +1128,8 @@ extern "C" {
 #define SDEFL_LVL_MIN   0
 #define SDEFL_LVL_DEF   5
 #define SDEFL_LVL_MAX   8
+#define SDEFL_LVL_RLE   9   /* NOTE: rpng addition, run-length only matching (distance 1), no hash chains */
+#define SDEFL_BLK_SPLIT 0x100 /* NOTE: rpng addition, level flag: blocks split where estimated size decreases */
 
 struct sdefl_freq {
   unsigned lit[SDEFL_SYM_MAX];
@@ -582,6 +1187,7 @@ extern "C" {
 
 struct sinfl {
   const unsigned char *bitptr;
+  const unsigned char *bitend;
   unsigned long long bitbuf;
   int bitcnt;
 
@@ -598,6 +1204,27 @@ extern int zsinflate(void *out, int cap, const void *in, int size);
 
 #endif /* SINFL_H_INCLUDED */
 
+// Deflate level used by fast encode profile
+// NOTE: Run-length only matching is an rpng sdefl addition, fastest sdefl level is used with external sdefl
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+    #define RPNG_FAST_COMPRESSION_LEVEL     SDEFL_LVL_RLE
+#else
+    #define RPNG_FAST_COMPRESSION_LEVEL     SDEFL_LVL_MIN
+#endif
+
+// Deflate levels used by max encode profile strategies
+// NOTE: Blocks splitting is an rpng sdefl addition, not available with external sdefl
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+    #define RPNG_MAX_COMPRESSION_LEVEL      (SDEFL_LVL_MAX | SDEFL_BLK_SPLIT)
+    #define RPNG_MAX_RLE_COMPRESSION_LEVEL  (SDEFL_LVL_RLE | SDEFL_BLK_SPLIT)
+#else
+    #define RPNG_MAX_COMPRESSION_LEVEL      SDEFL_LVL_MAX
+    #define RPNG_MAX_RLE_COMPRESSION_LEVEL  SDEFL_LVL_MIN
+#endif
+
+// Deflate level used to compress scanline filter candidates (max encode profile)
+#define RPNG_FILTER_TRIAL_LEVEL             SDEFL_LVL_MIN
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -630,12 +1257,30 @@ char *rpng_load_image(const char *filename, int *width, int *height, int *color_
     char *data = NULL;
 
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    bool mapped = false;
+    char *file_data = load_file_mapped(filename, &file_size, &mapped);
 
     if (file_data != NULL)
     {
-        data = rpng_load_image_from_memory(file_data, width, height, color_channels, bit_depth);
-        RPNG_FREE(file_data);
+        rpng_image_info info = { 0 };
+
+        if (rpng_read_image_info(file_data, file_size, &info))
+        {
+            *width = info.width;
+            *height = info.height;
+            *color_channels = info.color_channels;
+            *bit_depth = info.bit_depth;
+
+            data = (char *)RPNG_MALLOC((size_t)info.width*info.height*info.pixel_size);
+
+            if ((data != NULL) && (rpng_decode_image_data(file_data, file_size, &info, (unsigned char *)data) != RPNG_SUCCESS))
+            {
+                RPNG_FREE(data);
+                data = NULL;
+            }
+        }
+
+        unload_file_mapped(file_data, file_size, mapped);
     }
 
     return data;
@@ -649,26 +1294,91 @@ char *rpng_load_image_indexed(const char *filename, int *width, int *height, rpn
     char *data = NULL;
 
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    bool mapped = false;
+    char *file_data = load_file_mapped(filename, &file_size, &mapped);
 
     if (file_data != NULL)
     {
         data = rpng_load_image_indexed_from_memory(file_data, width, height, palette);
-        RPNG_FREE(file_data);
+        unload_file_mapped(file_data, file_size, mapped);
     }
 
     return data;
 }
 
+// Load a PNG file image info (IHDR chunk), image data is not loaded
+// NOTE: Only the file header is read: signature + IHDR chunk (33 bytes)
+bool rpng_load_image_info(const char *filename, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    bool result = false;
+
+#if !defined(RPNG_NO_STDIO)
+    if ((filename != NULL) && file_exists(filename))
+    {
+        FILE *file = fopen(filename, "rb");
+
+        if (file != NULL)
+        {
+            char header[33] = { 0 };
+            rpng_image_info info = { 0 };
+
+            if ((fread(header, 1, 33, file) == 33) && rpng_read_image_info(header, 33, &info))
+            {
+                *width = info.width;
+                *height = info.height;
+                *color_channels = info.color_channels;
+                *bit_depth = info.bit_depth;
+                result = true;
+            }
+
+            fclose(file);
+        }
+        else RPNG_LOG("FILEIO: [%s] Failed to open file\n", filename);
+    }
+#else
+    (void)filename;
+    (void)width;
+    (void)height;
+    (void)color_channels;
+    (void)bit_depth;
+#endif
+
+    return result;
+}
+
+// Load a PNG file image data into a provided buffer, no memory is allocated for image data
+int rpng_load_image_to_buffer(const char *filename, char *data, int data_size, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    int result = RPNG_ERROR_FILE_OPEN;
+
+    int file_size = 0;
+    bool mapped = false;
+    char *file_data = load_file_mapped(filename, &file_size, &mapped);
+
+    if (file_data != NULL)
+    {
+        result = rpng_load_image_to_buffer_from_memory(file_data, file_size, data, data_size, width, height, color_channels, bit_depth);
+        unload_file_mapped(file_data, file_size, mapped);
+    }
+
+    return result;
+}
+
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
 int rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth)
+{
+    return rpng_save_image_ex(filename, data, width, height, color_channels, bit_depth, RPNG_ENCODE_BALANCED);
+}
+
+// Save a PNG file from image data with requested encode profile (rpng_encode_profile)
+int rpng_save_image_ex(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth, int encode_profile)
 {
     int result = 0;
 
     int file_output_size = 0;
-    char *file_output = rpng_save_image_to_memory(data, width, height, color_channels, bit_depth, &file_output_size);
+    char *file_output = rpng_save_image_to_memory_ex(data, width, height, color_channels, bit_depth, encode_profile, &file_output_size);
 
     if ((file_output != NULL) && (file_output_size > 0))
     {
@@ -758,305 +1468,421 @@ rpng_chunk *rpng_chunk_read_all(const char *filename, int *count)
 // Remove text chunk by type
 void rpng_chunk_remove(const char *filename, const char *chunk_type)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    if (file_data != NULL)
-    {
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_remove_from_memory(file_data, chunk_type, &file_output_size);
-        save_file_from_buffer(filename, file_output, file_output_size);
-
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_remove(edit, chunk_type);
+    rpng_chunk_edit_commit(edit);
 }
 
-// Remove all chunks except: IHDR-IDAT-IEND
+// Remove all chunks except: IHDR-PLTE-IDAT-IEND
 void rpng_chunk_remove_ancillary(const char *filename)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    if (file_data != NULL)
-    {
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_remove_ancillary_from_memory(file_data, &file_output_size);
-        save_file_from_buffer(filename, file_output, file_output_size);
-
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_remove_ancillary(edit);
+    rpng_chunk_edit_commit(edit);
 }
 
 // Add one new chunk (any kind)
 // NOTE: Chunk is added by default after IHDR
 void rpng_chunk_write(const char *filename, rpng_chunk chunk)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    int file_output_size = 0;
-    char *file_output = NULL;
-    
-    if (file_data != NULL)
-    {
-        file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write(edit, chunk);
+    rpng_chunk_edit_commit(edit);
 }
 
 // Write text chunk data into PNG
 // NOTE: It will be added just after IHDR chunk
-// tEXt chunk data:
-//   unsigned char *keyword;     // Keyword: 1-80 bytes (must end with NULL separator: /0)
-//   unsigned char *text;        // Text: n bytes (character string, no NULL terminated required)
-// Keyword/Text usual values:
-//   Title            Short (one line) title or caption for image
-//   Author           Name of image's creator
-//   Description      Description of image (possibly long)
-//   Copyright        Copyright notice
-//   Creation Time    Time of original image creation
-//   Software         Software used to create the image
-//   Disclaimer       Legal disclaimer
-//   Warning          Warning of nature of content
-//   Source           Device used to create the image
-//   Comment          Miscellaneous comment
 void rpng_chunk_write_text(const char *filename, char *keyword, char *text)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_text(edit, keyword, text);
+    rpng_chunk_edit_commit(edit);
+}
 
-    if (file_data != NULL)
-    {
-        rpng_chunk chunk = { 0 };
+// Write zTXt chunk, DEFLATE compressed text
+void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text)
+{
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_comp_text(edit, keyword, text);
+    rpng_chunk_edit_commit(edit);
+}
 
-        int keyword_len = (int)strlen(keyword);
-        int text_len = (int)strlen(text);
+// Write gAMA chunk
+void rpng_chunk_write_gamma(const char *filename, float gamma)
+{
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_gamma(edit, gamma);
+    rpng_chunk_edit_commit(edit);
+}
 
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "tEXt", 4);
-        chunk.length = keyword_len + 1 + text_len;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        memcpy(chunk.data, keyword, keyword_len);
-        memcpy(chunk.data + keyword_len + 1, text, text_len);
-        chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
+// Write sRGB chunk, requires gAMA chunk
+void rpng_chunk_write_srgb(const char *filename, char srgb_type)
+{
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_srgb(edit, srgb_type);
+    rpng_chunk_edit_commit(edit);
+}
 
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
+// Write tIME chunk
+void rpng_chunk_write_time(const char *filename, short year, char month, char day, char hour, char min, char sec)
+{
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_time(edit, year, month, day, hour, min, sec);
+    rpng_chunk_edit_commit(edit);
+}
 
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
+// Write pHYs chunk
+void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int pixels_unit_y, bool meters)
+{
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_physical_size(edit, pixels_unit_x, pixels_unit_y, meters);
+    rpng_chunk_edit_commit(edit);
+}
 
-        RPNG_FREE(chunk.data);
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+// Write cHRM chunk
+void rpng_chunk_write_chroma(const char *filename, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
+{
+    rpng_chunk_edit *edit = rpng_chunk_edit_begin(filename);
+    rpng_chunk_edit_write_chroma(edit, white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y);
+    rpng_chunk_edit_commit(edit);
 }
 
-// Write zTXt chunk, DEFLATE compressed text
-// zTXt chunk information and size:
-//    unsigned char *keyword;           // Keyword: 1-80 bytes (must end with NULL separator: /0)
-//    unsigned char comp;               // Compression method (0 for DEFLATE)
-//    unsigned char *comp_text;         // Compressed text: n bytes
-void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text)
+// Begin chunks edition transaction
+// NOTE: File data is loaded and chunks structure validated, edits are queued until commit
+rpng_chunk_edit *rpng_chunk_edit_begin(const char *filename)
 {
+    rpng_chunk_edit *edit = NULL;
+
     int file_size = 0;
     char *file_data = load_file_to_buffer(filename, &file_size);
 
-    if (file_data != NULL)
+    if ((file_data != NULL) && (file_size >= 8) && (memcmp(file_data, png_signature, 8) == 0))  // Check valid PNG file
     {
-        // Create chunk and fill with data
-        rpng_chunk chunk = { 0 };
+        // Validate chunks structure, looking for IEND chunk
+        int offset = 8;
+        int iend_offset = -1;
+        bool has_palette = false;
 
-        int keyword_len = (int)strlen(keyword);
-        int text_len = (int)strlen(text);
+        while ((file_size - offset) >= 12)
+        {
+            unsigned int length = read_uint32_be(file_data + offset);
+            if (length > (unsigned int)(file_size - offset - 12)) break;    // WARNING: Chunk data out of file bounds
 
-        // Compress filtered image data and generate a valid zlib stream
-        struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
-        int bounds = sdefl_bound(text_len);
-        unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
-        int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, RPNG_COMPRESSION_LEVEL);
-        RPNG_FREE(sde);
+            if (memcmp(file_data + offset + 4, "PLTE", 4) == 0) has_palette = true;
+            else if (memcmp(file_data + offset + 4, "IEND", 4) == 0)
+            {
+                iend_offset = offset;
+                break;
+            }
 
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "zTXt", 4);
-        chunk.length = keyword_len + 1 + 1 + comp_text_size;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        memcpy(chunk.data, keyword, keyword_len);
-        memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
+            offset += (4 + 4 + length + 4);
+        }
 
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
+        if (iend_offset > 8)
+        {
+            int filename_len = (int)strlen(filename);
+
+            edit = (rpng_chunk_edit *)RPNG_CALLOC(1, sizeof(rpng_chunk_edit));
+            edit->filename = (char *)RPNG_CALLOC(filename_len + 1, 1);
+            memcpy(edit->filename, filename, filename_len);
+            edit->file_data = file_data;
+            edit->file_size = file_size;
+            edit->iend_offset = iend_offset;
+            edit->has_palette = has_palette;
+        }
+        else RPNG_LOG("WARNING: [%s] PNG chunks not valid, IEND chunk not found\n", filename);
+    }
 
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
+    if (edit == NULL) RPNG_FREE(file_data);
 
-        RPNG_FREE(chunk.data);
-        RPNG_FREE(comp_text);
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    return edit;
 }
 
-// Write gAMA chunk
-// NOTE: Gamma is stored as one int: gamma*100000
-void rpng_chunk_write_gamma(const char *filename, float gamma)
+// Apply queued edits and save file, edit transaction is freed
+// NOTE: File is written once, untouched chunks are copied verbatim (including CRC),
+// CRC is only computed for new chunks, new chunks are added after IHDR in queued order
+int rpng_chunk_edit_commit(rpng_chunk_edit *edit)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int result = RPNG_ERROR_FILE_OPEN;
 
-    if (file_data != NULL)
+    if (edit == NULL) return result;
+
+    // Compute output size upper bound: source file chunks + all new chunks
+    int output_size_max = edit->iend_offset + 12;
+    for (int i = 0; i < edit->op_count; i++)
     {
-        rpng_chunk chunk = { 0 };
+        if (edit->ops[i].type == RPNG_CHUNK_EDIT_WRITE) output_size_max += (4 + 4 + edit->ops[i].chunk.length + 4);
+    }
 
-        int gamma_value = (int)(gamma*100000);
+    char *output_buffer = (char *)RPNG_MALLOC(output_size_max);
 
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "gAMA", 4);
-        chunk.length = 4;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        gamma_value = swap_endian(gamma_value);
-        memcpy(chunk.data, &gamma_value, 4);
-        chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
+    if (output_buffer != NULL)
+    {
+        int output_size = 0;
+        int offset = 8;
+        bool palette_found = false;
 
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
+        memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
+        output_size += 8;
 
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
+        while (offset < edit->iend_offset)
+        {
+            const char *chunk_type = edit->file_data + offset + 4;
+            unsigned int length = read_uint32_be(edit->file_data + offset);
 
-        RPNG_FREE(chunk.data);
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
+            if (memcmp(chunk_type, "PLTE", 4) == 0) palette_found = true;
+
+            if (rpng_chunk_edit_keep(edit, chunk_type, -1, palette_found))
+            {
+                memcpy(output_buffer + output_size, edit->file_data + offset, 4 + 4 + length + 4);  // Length + FOURCC + chunk_size + CRC32
+                output_size += (4 + 4 + length + 4);
+            }
+
+            // Add new chunks after IHDR chunk
+            if (memcmp(chunk_type, "IHDR", 4) == 0)
+            {
+                for (int i = 0; i < edit->op_count; i++)
+                {
+                    rpng_chunk *chunk = &edit->ops[i].chunk;
+
+                    if ((edit->ops[i].type == RPNG_CHUNK_EDIT_WRITE) && rpng_chunk_edit_keep(edit, chunk->type, i, edit->has_palette))
+                    {
+                        write_uint32_be(output_buffer + output_size, chunk->length);                         // Write chunk length
+                        memcpy(output_buffer + output_size + 4, chunk->type, 4);                            // Write chunk type
+                        if (chunk->length > 0) memcpy(output_buffer + output_size + 4 + 4, chunk->data, chunk->length);  // Write chunk data
+                        write_uint32_be(output_buffer + output_size + 4 + 4 + chunk->length, compute_chunk_crc32(chunk->type, chunk->data, chunk->length));  // Write CRC32 (computed over type + data)
+                        output_size += (4 + 4 + chunk->length + 4);
+                    }
+                }
+            }
+
+            offset += (4 + 4 + length + 4);     // Move to next chunk
+        }
+
+        // Write IEND chunk
+        memcpy(output_buffer + output_size, edit->file_data + edit->iend_offset, 4 + 4 + 4);
+        output_size += 12;
+
+        result = save_file_from_buffer(edit->filename, output_buffer, output_size);
+
+        RPNG_FREE(output_buffer);
     }
+    else result = RPNG_ERROR_MEMORY_ALLOC;
+
+    rpng_chunk_edit_cancel(edit);
+
+    return result;
 }
 
-// Write sRGB chunk, requires gAMA chunk
+// Discard queued edits, edit transaction is freed
+void rpng_chunk_edit_cancel(rpng_chunk_edit *edit)
+{
+    if (edit == NULL) return;
+
+    for (int i = 0; i < edit->op_count; i++) RPNG_FREE(edit->ops[i].chunk.data);
+
+    RPNG_FREE(edit->ops);
+    RPNG_FREE(edit->file_data);
+    RPNG_FREE(edit->filename);
+    RPNG_FREE(edit);
+}
+
+// Queue removing one chunk type
+// NOTE: All chunks of that type are removed, including new chunks queued before
+void rpng_chunk_edit_remove(rpng_chunk_edit *edit, const char *chunk_type)
+{
+    rpng_chunk chunk = { 0 };
+    memcpy(chunk.type, chunk_type, 4);
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_REMOVE, chunk);
+}
+
+// Queue removing all chunks except: IHDR-PLTE-IDAT-IEND
+// NOTE: tRNS chunk is also preserved if PLTE chunk is available
+void rpng_chunk_edit_remove_ancillary(rpng_chunk_edit *edit)
+{
+    rpng_chunk chunk = { 0 };
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_REMOVE_ANCILLARY, chunk);
+}
+
+// Queue writing one new chunk (any kind)
+// NOTE: Chunk data is copied, CRC can be left to 0, it's calculated internally on commit
+void rpng_chunk_edit_write(rpng_chunk_edit *edit, rpng_chunk chunk)
+{
+    if (edit == NULL) return;
+
+    rpng_chunk chunk_copy = { 0 };
+    memcpy(chunk_copy.type, chunk.type, 4);
+
+    if ((chunk.data != NULL) && (chunk.length > 0))
+    {
+        chunk_copy.length = chunk.length;
+        chunk_copy.data = (char *)RPNG_MALLOC(chunk.length);
+        memcpy(chunk_copy.data, chunk.data, chunk.length);
+    }
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk_copy);
+}
+
+// Queue writing tEXt chunk
+// tEXt chunk data:
+//   unsigned char *keyword;     // Keyword: 1-80 bytes (must end with NULL separator: /0)
+//   unsigned char *text;        // Text: n bytes (character string, no NULL terminated required)
+// Keyword/Text usual values:
+//   Title            Short (one line) title or caption for image
+//   Author           Name of image's creator
+//   Description      Description of image (possibly long)
+//   Copyright        Copyright notice
+//   Creation Time    Time of original image creation
+//   Software         Software used to create the image
+//   Disclaimer       Legal disclaimer
+//   Warning          Warning of nature of content
+//   Source           Device used to create the image
+//   Comment          Miscellaneous comment
+void rpng_chunk_edit_write_text(rpng_chunk_edit *edit, char *keyword, char *text)
+{
+    if (edit == NULL) return;
+
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    // Fill chunk with required data
+    memcpy(chunk.type, "tEXt", 4);
+    chunk.length = keyword_len + 1 + text_len;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 1, text, text_len);
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
+}
+
+// Queue writing zTXt chunk, DEFLATE compressed text
+// zTXt chunk information and size:
+//    unsigned char *keyword;           // Keyword: 1-80 bytes (must end with NULL separator: /0)
+//    unsigned char comp;               // Compression method (0 for DEFLATE)
+//    unsigned char *comp_text;         // Compressed text: n bytes
+void rpng_chunk_edit_write_comp_text(rpng_chunk_edit *edit, char *keyword, char *text)
+{
+    if (edit == NULL) return;
+
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    // Compress text data and generate a valid zlib stream
+    struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
+    int bounds = sdefl_bound(text_len);
+    unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
+    int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, RPNG_COMPRESSION_LEVEL);
+    RPNG_FREE(sde);
+
+    // Fill chunk with required data
+    memcpy(chunk.type, "zTXt", 4);
+    chunk.length = keyword_len + 1 + 1 + comp_text_size;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
+    RPNG_FREE(comp_text);
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
+}
+
+// Queue writing gAMA chunk
+// NOTE: Gamma is stored as one int: gamma*100000
+void rpng_chunk_edit_write_gamma(rpng_chunk_edit *edit, float gamma)
+{
+    if (edit == NULL) return;
+
+    rpng_chunk chunk = { 0 };
+
+    // Fill chunk with required data
+    memcpy(chunk.type, "gAMA", 4);
+    chunk.length = 4;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    write_uint32_be(chunk.data, (unsigned int)(int)(gamma*100000));
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
+}
+
+// Queue writing sRGB chunk, requires gAMA chunk
 // NOTE: This chunk only contains 1 byte of data defining rendering intent:
 //   0: Perceptual
 //   1: Relative colorimetric
 //   2: Saturation
 //   3: Absolute colorimetric
-void rpng_chunk_write_srgb(const char *filename, char srgb_type)
+void rpng_chunk_edit_write_srgb(rpng_chunk_edit *edit, char srgb_type)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    if (edit == NULL) return;
 
     rpng_chunk chunk = { 0 };
 
     if ((srgb_type < 0) || (srgb_type > 3)) srgb_type = 0;
 
     // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
     memcpy(chunk.type, "sRGB", 4);
     chunk.length = 1;
     chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    memcpy(chunk.data, &srgb_type, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
+    chunk.data[0] = srgb_type;
 
-    RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
 }
 
-// Write tIME chunk
+// Queue writing tIME chunk
 // tIME chunk information and size:
-//   unsigned short year;         // Year complete, i.e. 1995
+//   unsigned short year;         // Year complete, i.e. 1995 (big endian)
 //   unsigned char month;         // 1 to 12
 //   unsigned char day;           // 1 to 31
 //   unsigned char hour;          // 0 to 23
 //   unsigned char minute;        // 0 to 59
 //   unsigned char second;        // 0 to 60 (yes, 60, for leap seconds; not 61, a common error)
-void rpng_chunk_write_time(const char *filename, short year, char month, char day, char hour, char min, char sec)
+void rpng_chunk_edit_write_time(rpng_chunk_edit *edit, short year, char month, char day, char hour, char min, char sec)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    if (edit == NULL) return;
 
     rpng_chunk chunk = { 0 };
 
     // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
     memcpy(chunk.type, "tIME", 4);
     chunk.length = 7;
     chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    memcpy(chunk.data, &year, 2);
-    memcpy(chunk.data + 2, &month, 1);
-    memcpy(chunk.data + 3, &day, 1);
-    memcpy(chunk.data + 4, &hour, 1);
-    memcpy(chunk.data + 5, &min, 1);
-    memcpy(chunk.data + 6, &sec, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
-    RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
+    chunk.data[0] = (char)((year >> 8) & 0xff);
+    chunk.data[1] = (char)(year & 0xff);
+    chunk.data[2] = month;
+    chunk.data[3] = day;
+    chunk.data[4] = hour;
+    chunk.data[5] = min;
+    chunk.data[6] = sec;
+
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
 }
 
-// Write pHYs chunk
+// Queue writing pHYs chunk
 // pHYs chunk information and size:
 //   unsigned int pixels_per_unit_x;
 //   unsigned int pixels_per_unit_y;
 //   unsigned char unit_specifier;       // 0 - Unit unknown, 1 - Unit is meter
-void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int pixels_unit_y, bool meters)
+void rpng_chunk_edit_write_physical_size(rpng_chunk_edit *edit, int pixels_unit_x, int pixels_unit_y, bool meters)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    if (edit == NULL) return;
 
     rpng_chunk chunk = { 0 };
 
     // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
     memcpy(chunk.type, "pHYs", 4);
     chunk.length = 9;
     chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    pixels_unit_x = swap_endian(pixels_unit_x);
-    memcpy(chunk.data, &pixels_unit_x, 4);
-    pixels_unit_y = swap_endian(pixels_unit_y);
-    memcpy(chunk.data + 4, &pixels_unit_y, 4);
-    char meters_value = (meters)? 1 : 0;
-    memcpy(chunk.data + 8, &meters_value, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
+    write_uint32_be(chunk.data, (unsigned int)pixels_unit_x);
+    write_uint32_be(chunk.data + 4, (unsigned int)pixels_unit_y);
+    chunk.data[8] = (meters)? 1 : 0;
 
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
-    RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
 }
 
-// Write cHRM chunk
+// Queue writing cHRM chunk
 // cHRM chunk information and size:
 //   unsigned int white_point_x;
 //   unsigned int white_point_y;
@@ -1067,46 +1893,20 @@ void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int
 //   unsigned int bluex;
 //   unsigned int bluey;
 // NOTE: Each value is stored as one int: value*100000
-void rpng_chunk_write_chroma(const char *filename, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
+void rpng_chunk_edit_write_chroma(rpng_chunk_edit *edit, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    if (edit == NULL) return;
 
     rpng_chunk chunk = { 0 };
+    float values[8] = { white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y };
 
     // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "pHYs", 4);
+    memcpy(chunk.type, "cHRM", 4);
     chunk.length = 8*4;     // 8 integer values
     chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    int white_x_value = swap_endian((int)(white_x*100000));
-    memcpy(chunk.data, &white_x_value, 4);
-    int white_y_value = swap_endian((int)(white_y*100000));
-    memcpy(chunk.data + 4, &white_y_value, 4);
-    int red_x_value = swap_endian((int)(red_x*100000));
-    memcpy(chunk.data + 8, &red_x_value, 4);
-    int red_y_value = swap_endian((int)(red_y*100000));
-    memcpy(chunk.data + 12, &red_y_value, 4);
-    int green_x_value = swap_endian((int)(green_x*100000));
-    memcpy(chunk.data + 16, &green_x_value, 4);
-    int green_y_value = swap_endian((int)(green_y*100000));
-    memcpy(chunk.data + 20, &green_y_value, 4);
-    int blue_x_value = swap_endian((int)(blue_x*100000));
-    memcpy(chunk.data + 24, &blue_x_value, 4);
-    int blue_y_value = swap_endian((int)(blue_y*100000));
-    memcpy(chunk.data + 28, &blue_y_value, 4);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
+    for (int i = 0; i < 8; i++) write_uint32_be(chunk.data + i*4, (unsigned int)(int)(values[i]*100000));
 
-    RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
+    rpng_chunk_edit_push(edit, RPNG_CHUNK_EDIT_WRITE, chunk);
 }
 
 // Output info about the chunks
@@ -1148,26 +1948,34 @@ bool rpng_chunk_check_all_valid(const char *filename)
     rpng_chunk *chunks = rpng_chunk_read_all(filename, &count);
     if (chunks == NULL) return false;
 
-    unsigned int crc = 0;
-    char *chunk_type_data = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
+    // Verify chunks CRC, in parallel if there is enough data to verify
+    // NOTE: Every job verifies one chunk, writing only its own result
+    bool *chunks_valid = (bool *)RPNG_CALLOC(count, sizeof(bool));
 
-    if (chunk_type_data != NULL)
+    if (chunks_valid != NULL)
     {
+        rpng_crc32_check_job job = { chunks, chunks_valid };
+
+        int data_size = 0;
+        for (int i = 0; i < count; i++) data_size += chunks[i].length;
+
+        int thread_count = (data_size >= 2*RPNG_THREAD_BAND_SIZE)? rpng_get_thread_count(count) : 1;
+
+        if (thread_count > 1) rpng_parallel_for(rpng_crc32_check_job_func, &job, count, thread_count);
+        else for (int i = 0; i < count; i++) rpng_crc32_check_job_func(&job, i, 0);
+
         for (int i = 0; i < count; i++)
         {
-            memcpy(chunk_type_data, chunks[i].type, 4);
-            memcpy(chunk_type_data + 4, chunks[i].data, chunks[i].length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunks[i].length);
-            crc = swap_endian(crc);
-
-            // Check computed CRC matches provided CRC
-            if (chunks[i].crc != crc)
+            if (!chunks_valid[i])
             {
                 result = false;
                 break;
             }
         }
+
+        RPNG_FREE(chunks_valid);
     }
+    else result = false;
 
     // Free chunks memory
     for (int i = 0; i < count; i++) RPNG_FREE(chunks[i].data);
@@ -1223,70 +2031,27 @@ void rpng_chunk_split_image_data(const char *filename, int split_size)
 // Functions operating on memory buffers data
 //----------------------------------------------------------------------------------------------------------
 // Load png data from memory buffer
+// NOTE: Buffer data size is not provided, PNG data is expected to end with IEND chunk
 char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth)
 {
     char *data = NULL;
+    int buffer_size = get_png_size_from_memory(buffer);
+    rpng_image_info info = { 0 };
 
-    rpng_chunk chunk_info = rpng_chunk_read_from_memory(buffer, "IHDR");
-
-    if (chunk_info.data == NULL) return data; // WARNING: Return if no info chunk has been loaded
-
-    // First chunk is always IHDR, we can check image data info
-    rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)chunk_info.data;
+    if (!rpng_read_image_info(buffer, buffer_size, &info)) return data; // WARNING: Return if image format not supported
 
-    *width = swap_endian(IHDRData->width);      // Image width
-    *height = swap_endian(IHDRData->height);    // Image height
-    *bit_depth = IHDRData->bit_depth;           // Bit depth
+    *width = info.width;
+    *height = info.height;
+    *color_channels = info.color_channels;
+    *bit_depth = info.bit_depth;
 
-    *color_channels = 0;
-    switch (IHDRData->color_type)
-    {
-        case 0: *color_channels = 1; break;     // Pixel format: 0-Grayscale
-        case 4: *color_channels = 2; break;     // Pixel format: 4-GrayAlpha
-        case 2: *color_channels = 3; break;     // Pixel format: 2-RGB
-        case 6: *color_channels = 4; break;     // Pixel format: 6-RGBA
-        case 3: *color_channels = 1; break;     // Pixel format: 3-Indexed (1 channel containing 8-bit indexed data)
-        default: break;
-    }
-
-    // TODO: Support bit depths of 1/2/4 bits? -> Convert to 8bit grayscale
-    if ((*color_channels == 1) && (*bit_depth != 8) && (*bit_depth != 16)) return data;  // Bit depth 1/2/4 not supported
-
-    // Additional info provided by IHDR (in case it was required)
-    //IHDRData->compression;        // Compression method: 0 (DEFLATE)
-    //IHDRData->filter;             // Filter method: 0 (default)
-    //IHDRData->interlace;          // Interlace scheme (optional): 0 (none)
+    data = (char *)RPNG_MALLOC((size_t)info.width*info.height*info.pixel_size);
 
-    if (*color_channels != 0)
+    if ((data != NULL) && (rpng_decode_image_data(buffer, buffer_size, &info, (unsigned char *)data) != RPNG_SUCCESS))
     {
-        // NOTE: All splitted chunks are joined on reading
-        rpng_chunk chunk_image = rpng_chunk_read_from_memory(buffer, "IDAT");
-
-        if (chunk_image.data != NULL)
-        {
-            // Verify data integrity CRC over all chunk data concatenated
-            unsigned int crc = 0;
-            char *chunk_type_data = (char *)RPNG_CALLOC(4 + chunk_image.length, 1);
-            memcpy(chunk_type_data, chunk_image.type, 4);
-            memcpy(chunk_type_data + 4, chunk_image.data, chunk_image.length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunk_image.length);
-            RPNG_FREE(chunk_type_data);
-
-            if (crc == chunk_image.crc) // Validate crc
-            {
-                int pixel_size = *color_channels*(*bit_depth/8);
-                data = rpng_inflate_image_data(chunk_image.data, chunk_image.length, *width, *height, pixel_size);
-
-                if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
-            }
-            else RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
-        }
-
-        RPNG_FREE(chunk_image.data);
+        RPNG_FREE(data);
+        data = NULL;
     }
-    else RPNG_LOG("WARNING: Failed to load file, image pixel format not supported\n");
-
-    RPNG_FREE(chunk_info.data);
 
     return data;
 }
@@ -1325,56 +2090,63 @@ char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *h
         if ((chunk_alpha.data != NULL) && (chunk_alpha.length == palette->color_count))
         {
             for (int i = 0; i < palette->color_count; i++) palette->colors[i].a = (unsigned char)chunk_alpha.data[i];
-
-            RPNG_FREE(chunk_alpha.data);
         }
 
-        // Load indexed image data
-        rpng_chunk chunk_info = rpng_chunk_read_from_memory(buffer, "IHDR");
-
-        // WARNING: Cast chunk_info data directly to expected IHDR struct layout
-        rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)chunk_info.data;
+        RPNG_FREE(chunk_alpha.data);
 
-        *width = swap_endian(IHDRData->width);      // Image width
-        *height = swap_endian(IHDRData->height);    // Image height
+        // Load indexed image data
+        int buffer_size = get_png_size_from_memory(buffer);
+        rpng_image_info info = { 0 };
 
         // Verify color type is indexed (3) and bit depth is 8
-        if ((IHDRData->color_type == 3) && (IHDRData->bit_depth == 8))
+        if (rpng_read_image_info(buffer, buffer_size, &info) && (info.color_type == 3))
         {
-            // NOTE: All splitted chunks are joined on reading
-            rpng_chunk chunk_image = rpng_chunk_read_from_memory(buffer, "IDAT");
+            *width = info.width;
+            *height = info.height;
 
-            if (chunk_image.data != NULL)
-            {
-                // Verify data integrity CRC over all chunk data concatenated
-                unsigned int crc = 0;
-                char *chunk_type_data = (char *)RPNG_CALLOC(4 + chunk_image.length, 1);
-                memcpy(chunk_type_data, chunk_image.type, 4);
-                memcpy(chunk_type_data + 4, chunk_image.data, chunk_image.length);
-                crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunk_image.length);
-                RPNG_FREE(chunk_type_data);
-
-                if (crc == chunk_image.crc) // Validate crc
-                {
-                    int pixel_size = (IHDRData->bit_depth/8); // NOTE: Assume 1 channel
-                    data = rpng_inflate_image_data(chunk_image.data, chunk_image.length, *width, *height, pixel_size);
+            data = (char *)RPNG_MALLOC((size_t)info.width*info.height);
 
-                    if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
-                }
-                else RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
+            if ((data != NULL) && (rpng_decode_image_data(buffer, buffer_size, &info, (unsigned char *)data) != RPNG_SUCCESS))
+            {
+                RPNG_FREE(data);
+                data = NULL;
             }
-
-            RPNG_FREE(chunk_image.data);
         }
-
-        RPNG_FREE(chunk_info.data);
     }
 
     return data;
 }
 
+// Load png data from memory buffer into provided buffer, no memory is allocated for image data
+// NOTE: Data size must be at least: width*height*color_channels*(bit_depth/8)
+int rpng_load_image_to_buffer_from_memory(const char *buffer, int buffer_size, char *data, int data_size, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    rpng_image_info info = { 0 };
+
+    if (!rpng_read_image_info(buffer, buffer_size, &info)) return RPNG_ERROR_PIXEL_FORMAT;
+
+    *width = info.width;
+    *height = info.height;
+    *color_channels = info.color_channels;
+    *bit_depth = info.bit_depth;
+
+    if ((data == NULL) || ((long long)data_size < (long long)info.width*info.height*info.pixel_size))
+    {
+        RPNG_LOG("WARNING: Provided buffer size not enough for image data\n");
+        return RPNG_ERROR_IMAGE_DATA;
+    }
+
+    return rpng_decode_image_data(buffer, buffer_size, &info, (unsigned char *)data);
+}
+
 // Save png data to memory buffer
 char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size)
+{
+    return rpng_save_image_to_memory_ex(data, width, height, color_channels, bit_depth, RPNG_ENCODE_BALANCED, output_size);
+}
+
+// Save png data to memory buffer with requested encode profile (rpng_encode_profile)
+char *rpng_save_image_to_memory_ex(const char *data, int width, int height, int color_channels, int bit_depth, int encode_profile, int *output_size)
 {
     char *output_buffer = NULL;
     int output_buffer_size = 0;
@@ -1402,7 +2174,16 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
     // Image data pre-processing to append filter type byte to every scanline
     int pixel_size = color_channels*(bit_depth/8);
     int comp_data_size = 0;
-    char *comp_data = rpng_deflate_image_data(data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, -1);
+    char *comp_data = NULL;
+
+    if (encode_profile == RPNG_ENCODE_MAX) comp_data = rpng_deflate_image_data_max(data, width*height*pixel_size, width, height, pixel_size, &comp_data_size);
+    else
+    {
+        int filter_type = -1;
+        int level = RPNG_COMPRESSION_LEVEL;
+        rpng_get_encode_settings(encode_profile, &filter_type, &level);
+        comp_data = rpng_deflate_image_data(data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, filter_type, level);
+    }
 
     // Security check to verify compression worked
     if ((comp_data != NULL) && (comp_data_size > 0))
@@ -1461,7 +2242,7 @@ char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int
     // Image data pre-processing to append filter type byte to every scanline
     int pixel_size = 1; // 1 byte per pixel (indexed data)
     int comp_data_size = 0;
-    char *comp_data = rpng_deflate_image_data(indexed_data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, 0);
+    char *comp_data = rpng_deflate_image_data(indexed_data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, 0, RPNG_COMPRESSION_LEVEL);
 
     // Security check to verify compression worked
     if ((comp_data != NULL) && (comp_data_size > 0))
@@ -1590,13 +2371,13 @@ int rpng_chunk_count_from_memory(const char *buffer)
     {
         buffer_ptr += 8;       // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
         {
             buffer_ptr += (4 + 4 + chunk_size + 4);    // Skip chunk Length + FOURCC + chunk data + CRC32
 
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunk_size = read_uint32_be(buffer_ptr);
             count++;
         }
 
@@ -1616,41 +2397,49 @@ rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_typ
     if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file
     {
         buffer_ptr += 8;   // Move pointer after signature
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         // In case chunk(s) requested is IDAT, all IDAT chunks are concatenated
+        // NOTE: Every IDAT chunk CRC32 is validated, if any is not valid, returned chunk CRC32 does not match data
         if (memcmp(chunk_type, "IDAT", 4) == 0)
         {
-            char *idat_data_concat = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, sizeof(char));
+            char *chunks_ptr = buffer_ptr;
             int idat_data_concat_size = 0;
+            bool idat_crc_valid = true;
 
+            // Compute concatenated data size and validate chunks
             while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
             {
                 if (memcmp(buffer_ptr + 4, chunk_type, 4) == 0) // Check next IDAT chunk
                 {
-                    memcpy(idat_data_concat + idat_data_concat_size, (char *)(buffer_ptr + 8), chunk_size);
+                    if (compute_chunk_crc32(buffer_ptr + 4, buffer_ptr + 8, chunk_size) != read_uint32_be(buffer_ptr + 8 + chunk_size)) idat_crc_valid = false;
                     idat_data_concat_size += chunk_size;
-
-                    // TODO: Validate every IDAT chunk CRC32
                 }
 
                 buffer_ptr += (4 + 4 + chunk_size + 4); // Move pointer to next chunk of input data
-                chunk_size = swap_endian(((int *)buffer_ptr)[0]); // Compute next chunk file_size
+                chunk_size = read_uint32_be(buffer_ptr); // Compute next chunk file_size
             }
 
-            // Fill chunk data with all accumulated IDAT
+            // Fill chunk data with all IDAT data concatenated
             chunk.length = idat_data_concat_size;
             memcpy(chunk.type, "IDAT", 4);
-            chunk.data = (char *)RPNG_CALLOC(idat_data_concat_size, sizeof(char));
-            memcpy(chunk.data, idat_data_concat, idat_data_concat_size);
-            RPNG_FREE(idat_data_concat);
+            chunk.data = (char *)RPNG_MALLOC(idat_data_concat_size + 1);
+            idat_data_concat_size = 0;
+
+            for (buffer_ptr = chunks_ptr; memcmp(buffer_ptr + 4, "IEND", 4) != 0; buffer_ptr += (4 + 4 + chunk_size + 4))
+            {
+                chunk_size = read_uint32_be(buffer_ptr);
+
+                if (memcmp(buffer_ptr + 4, chunk_type, 4) == 0)
+                {
+                    memcpy(chunk.data + idat_data_concat_size, buffer_ptr + 8, chunk_size);
+                    idat_data_concat_size += chunk_size;
+                }
+            }
 
             // Compute CRC32 for security
-            unsigned char *chunk_type_data = (unsigned char *)RPNG_CALLOC(4 + chunk.length, 1);
-            memcpy(chunk_type_data, chunk.type, 4);
-            memcpy(chunk_type_data + 4, chunk.data, chunk.length);
-            chunk.crc = compute_crc32(chunk_type_data, 4 + chunk.length);
-            RPNG_FREE(chunk_type_data);
+            chunk.crc = compute_chunk_crc32(chunk.type, chunk.data, chunk.length);
+            if (!idat_crc_valid) chunk.crc = ~chunk.crc;
         }
         else // Only one chunk required, not IDAT type
         {
@@ -1662,13 +2451,13 @@ rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_typ
                     memcpy(chunk.type, (char *)(buffer_ptr + 4), 4);
                     chunk.data = (char *)RPNG_MALLOC(chunk_size);
                     memcpy(chunk.data, buffer_ptr + 8, chunk_size);
-                    chunk.crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
+                    chunk.crc = read_uint32_be(buffer_ptr + 8 + chunk_size);
 
                     break;
                 }
 
                 buffer_ptr += (4 + 4 + chunk_size + 4); // Move pointer to next chunk of input data
-                chunk_size = swap_endian(((int *)buffer_ptr)[0]); // Compute next chunk file_size
+                chunk_size = read_uint32_be(buffer_ptr); // Compute next chunk file_size
             }
         }
     }
@@ -1690,7 +2479,7 @@ rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
         chunks = (rpng_chunk *)RPNG_CALLOC(RPNG_MAX_CHUNKS_COUNT, sizeof(rpng_chunk));
         buffer_ptr += 8; // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
         {
@@ -1698,10 +2487,10 @@ rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
             memcpy(chunks[counter].type, (char *)(buffer_ptr + 4), 4);
             chunks[counter].data = (char *)RPNG_MALLOC(chunk_size);
             memcpy(chunks[counter].data, buffer_ptr + 8, chunk_size);
-            chunks[counter].crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
+            chunks[counter].crc = read_uint32_be(buffer_ptr + 8 + chunk_size);
 
             buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunk_size = read_uint32_be(buffer_ptr);
 
             counter++;
             if (counter >= (RPNG_MAX_CHUNKS_COUNT - 2)) break;   // WARNING: Too many chunks!
@@ -1712,7 +2501,7 @@ rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
         memcpy(chunks[counter].type, (char *)(buffer_ptr + 4), 4);
         chunks[counter].data = (char *)RPNG_MALLOC(chunk_size);
         memcpy(chunks[counter].data, buffer_ptr + 8, chunk_size);
-        chunks[counter].crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
+        chunks[counter].crc = read_uint32_be(buffer_ptr + 8 + chunk_size);
         counter++;
 
         // Reallocate chunks file_size
@@ -1741,7 +2530,7 @@ char *rpng_chunk_remove_from_memory(const char *buffer, const char *chunk_type,
 
         buffer_ptr += 8;       // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
         {
@@ -1753,7 +2542,7 @@ char *rpng_chunk_remove_from_memory(const char *buffer, const char *chunk_type,
             }
 
             buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunk_size = read_uint32_be(buffer_ptr);
         }
 
         // Write IEND chunk
@@ -1787,7 +2576,7 @@ char *rpng_chunk_remove_ancillary_from_memory(const char *buffer, int *output_si
         output_buffer_size += 8;
         buffer_ptr += 8;       // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
         {
@@ -1804,7 +2593,7 @@ char *rpng_chunk_remove_ancillary_from_memory(const char *buffer, int *output_si
             }
 
             buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunk_size = read_uint32_be(buffer_ptr);
         }
 
         // Write IEND chunk
@@ -1836,7 +2625,7 @@ char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *ou
         output_buffer_size += 8;
         buffer_ptr += 8;       // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
         {
@@ -1851,20 +2640,15 @@ char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *ou
                 memcpy(output_buffer + output_buffer_size + 4, chunk.type, 4);                // Write chunk type
                 memcpy(output_buffer + output_buffer_size + 4 + 4, chunk.data, chunk.length); // Write chunk data
 
-                unsigned char *type_data = (unsigned char *)RPNG_MALLOC(4 + chunk.length);
-                memcpy(type_data, chunk.type, 4);
-                memcpy(type_data + 4, chunk.data, chunk.length);
-                unsigned int crc = compute_crc32(type_data, 4 + chunk.length);
+                unsigned int crc = compute_chunk_crc32(chunk.type, chunk.data, chunk.length);
                 crc = swap_endian(crc);
                 memcpy(output_buffer + output_buffer_size + 4 + 4 + chunk.length, &crc, 4);   // Write CRC32 (computed over type + data)
 
-                RPNG_FREE(type_data);
-
                 output_buffer_size += (4 + 4 + chunk.length + 4);  // Update output file file_size with new chunk
             }
 
             buffer_ptr += (4 + 4 + chunk_size + 4);           // Move pointer to next chunk of input data
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);  // Compute next chunk file_size
+            chunk_size = read_uint32_be(buffer_ptr);  // Compute next chunk file_size
         }
 
         // Write IEND chunk
@@ -1899,7 +2683,7 @@ char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size)
         output_buffer_size += 8;
         buffer_ptr += 8; // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0)         // While IEND chunk not reached
         {
@@ -1916,7 +2700,7 @@ char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size)
             }
 
             buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunk_size = read_uint32_be(buffer_ptr);
         }
 
         // Write IDAT combined chunk
@@ -1960,7 +2744,7 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
         output_buffer_size += 8;
         buffer_ptr += 8;       // Move pointer after signature
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        unsigned int chunk_size = read_uint32_be(buffer_ptr);
 
         while (memcmp(buffer_ptr + 4, "IEND", 4) != 0)         // While IEND chunk not reached
         {
@@ -2007,7 +2791,7 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
             }
 
             buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunk_size = read_uint32_be(buffer_ptr);
         }
 
         RPNG_FREE(idata_split_buffer);
@@ -2030,7 +2814,7 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
 //----------------------------------------------------------------------------------
 
 // Prefilter and compress image data
-static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type)
+static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type, int level)
 {
     char *idat_data = NULL;
 
@@ -2038,96 +2822,86 @@ static char *rpng_deflate_image_data(const char *image_data, int image_data_size
     //int pixel_size = color_channels*(bit_depth/8);
     int scanline_size = width*pixel_size;
     unsigned int data_filtered_size = (scanline_size + 1)*height;   // Adding 1 byte per scanline filter
-    unsigned char *data_filtered = (unsigned char *)RPNG_CALLOC(data_filtered_size, 1);
-
-    int out = 0, x = 0, a = 0, b = 0, c = 0;
-    int sum_value[5] = { 0 };
-    int best_filter = 0;
-
-    for (int y = 0; y < height; y++)
+    unsigned char *data_filtered = (unsigned char *)RPNG_MALLOC(data_filtered_size);
+
+    // Filtering job data, image is filtered in bands of scanlines
+    // NOTE: Filtering a scanline only depends on current and previous source scanlines,
+    // so bands can be filtered in parallel, every thread uses its own candidates scanlines
+    rpng_filter_job job = { 0 };
+    job.image_data = (const unsigned char *)image_data;
+    job.data_filtered = data_filtered;
+    job.scanline_size = scanline_size;
+    job.pixel_size = pixel_size;
+    job.height = height;
+    job.band_height = (scanline_size > 0)? RPNG_THREAD_BAND_SIZE/scanline_size : height;
+    if (job.band_height < 1) job.band_height = 1;
+    job.forced_filter_type = forced_filter_type;
+
+    int band_count = (height + job.band_height - 1)/job.band_height;
+    int thread_count = rpng_get_thread_count(band_count);
+
+    // NOTE: First scanline is filtered against a zeroed previous scanline, as defined by PNG specs,
+    // it avoids checking image bounds for every processed byte
+    unsigned char *zero_scanline = (unsigned char *)RPNG_CALLOC(scanline_size, 1);
+    job.zero_scanline = zero_scanline;
+
+    // Scanlines to store the filtered candidates when choosing best filter (Sub, Up, Average, Paeth)
+    unsigned char *filter_scanlines = NULL;
+    if (forced_filter_type == -1) filter_scanlines = (unsigned char *)RPNG_MALLOC(4*scanline_size*thread_count);
+    job.filter_scanlines = filter_scanlines;
+
+    // Compressor states and compressed data buffers for filter trials, every candidate is compressed
+    // NOTE: Only previous scanlines of the same band are used as context, output does not depend on the number of threads
+    if (forced_filter_type == -2)
     {
-        if (forced_filter_type == -1)
-        {
-            // Choose the best filter type for every scanline
-            // REF: https://www.w3.org/TR/PNG-Encoders.html#E.Filter-selection
-            for (int p = 0; p < scanline_size; p++)
-            {
-                // x = current byte
-                // a = left pixel byte (from current)
-                // b = above pixel byte (from current)
-                // c = left pixel byte (from b)
-                x = (int)((unsigned char *)image_data)[scanline_size*y + p];
-                a = (p >= pixel_size) ? (int)((unsigned char *)image_data)[scanline_size*y + p - pixel_size] : 0;
-                b = (y > 0) ? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p] : 0;
-                c = (y > 0) ? ((p >= pixel_size) ? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p - pixel_size] : 0) : 0;
-
-                // Heuristic: Compute the output scanline using all five filters
-                // REF: https://www.w3.org/TR/PNG/#9Filters
-                for (int filter = 0; filter < 5; filter++)
-                {
-                    switch (filter)
-                    {
-                        case 0: out = x; break;
-                        case 1: out = x - a; break;
-                        case 2: out = x - b; break;
-                        case 3: out = x - ((a + b)>>1); break;
-                        case 4: out = x - rpng_paeth_predictor(a, b, c); break;
-                        default: break;
-                    }
-
-                    sum_value[filter] += abs((signed char)out);
-                }
-            }
+        job.trial_data_size = sdefl_bound(RPNG_FILTER_TRIAL_CONTEXT + scanline_size + 1);
+        job.trial_states = (struct sdefl *)RPNG_CALLOC(thread_count, sizeof(struct sdefl));
+        job.trial_data = (unsigned char *)RPNG_MALLOC((size_t)job.trial_data_size*thread_count);
+    }
 
-            // Select the filter that gives the smallest sum of absolute values of outputs.
-            // NOTE: Considering the output bytes as signed differences for the test.
-            best_filter = 0;
-            int best_value = sum_value[0];
+    if ((data_filtered == NULL) || (zero_scanline == NULL) || ((forced_filter_type == -1) && (filter_scanlines == NULL)) ||
+        ((forced_filter_type == -2) && ((job.trial_states == NULL) || (job.trial_data == NULL))))
+    {
+        RPNG_FREE(data_filtered);
+        RPNG_FREE(zero_scanline);
+        RPNG_FREE(filter_scanlines);
+        RPNG_FREE(job.trial_states);
+        RPNG_FREE(job.trial_data);
+        RPNG_LOG("WARNING: Image data filtering failed, memory could not be allocated\n");
+        return idat_data;
+    }
 
-            for (int filter = 1; filter < 5; filter++)
-            {
-                if (sum_value[filter] < best_value)
-                {
-                    best_value = sum_value[filter];
-                    best_filter = filter;
-                }
-            }
-        }
-        else if ((forced_filter_type >= 0) && (forced_filter_type <= 4)) best_filter = forced_filter_type;
+    if (thread_count > 1) rpng_parallel_for(rpng_filter_scanlines_job, &job, band_count, thread_count);
+    else
+    {
+        for (int band = 0; band < band_count; band++) rpng_filter_scanlines_job(&job, band, 0);
+    }
 
-        // Register scanline filter byte
-        data_filtered[(scanline_size + 1)*y] = best_filter;
+    RPNG_FREE(zero_scanline);
+    RPNG_FREE(filter_scanlines);
+    RPNG_FREE(job.trial_states);
+    RPNG_FREE(job.trial_data);
 
-        // Apply the best_filter to scanline
-        for (int p = 0; p < scanline_size; p++)
-        {
-            x = (int)((unsigned char *)image_data)[scanline_size*y + p];
-            a = (p >= pixel_size)? (int)((unsigned char *)image_data)[scanline_size*y + p - pixel_size] : 0;
-            b = (y > 0)? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p] : 0;
-            c = (y > 0)? ((p >= pixel_size) ? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p - pixel_size] : 0) : 0;
+    // Compress filtered image data and generate a valid zlib stream
+    char *comp_data = NULL;
+    int comp_data_size = 0;
 
-            switch (best_filter)
-            {
-                case 0: out = x; break;
-                case 1: out = x - a; break;
-                case 2: out = x - b; break;
-                case 3: out = x - ((a + b)>>1); break;
-                case 4: out = x - rpng_paeth_predictor(a, b, c); break;
-                default: break;
-            }
+#if defined(RPNG_DEFLATE_PARALLEL)
+    // Big images are split in chunks compressed in parallel
+    // NOTE: Output does not depend on the number of threads used
+    if (data_filtered_size >= 2*RPNG_DEFLATE_CHUNK_SIZE) comp_data = rpng_deflate_parallel(data_filtered, data_filtered_size, level, &comp_data_size);
+#endif
 
-            // Register scanline filtered values, byte by byte
-            data_filtered[(scanline_size + 1)*y + 1 + p] = (unsigned char)out;
-        }
+    if (comp_data == NULL)
+    {
+        struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
+        int bounds = sdefl_bound(data_filtered_size);
+        comp_data = (char *)RPNG_CALLOC(bounds, 1);
+        comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, level);
+        RPNG_FREE(sde);
     }
 
-    // Compress filtered image data and generate a valid zlib stream
-    struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
-    int bounds = sdefl_bound(data_filtered_size);
-    char *comp_data = (char *)RPNG_CALLOC(bounds, 1);
-    int comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, RPNG_COMPRESSION_LEVEL);
     RPNG_FREE(data_filtered);
-    RPNG_FREE(sde);
 
     if ((comp_data != NULL) && (comp_data_size > 0))
     {
@@ -2140,78 +2914,891 @@ static char *rpng_deflate_image_data(const char *image_data, int image_data_size
     return idat_data;
 }
 
-// Decompress and unfilter image data (IDAT)
-static char *rpng_inflate_image_data(char *image_data, int image_data_size, int width, int height, int pixel_size)
+// Prefilter and compress image data trying multiple strategies, smallest compressed data is kept
+// NOTE: Strategies run in parallel for small images, big images run them one by one (every strategy
+// is already filtered and compressed in parallel), keeping memory usage bounded to two compressed outputs
+static char *rpng_deflate_image_data_max(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size)
 {
-    char *image_data_unfiltered = NULL;
-    char *image_data_filtered = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1); // WARNING: Allocate enough memory to load full image decompressed
-
-    // Decompress IDAT chunk data
-    int image_data_decomp_size = zsinflate(image_data_filtered, RPNG_MAX_OUTPUT_SIZE, image_data, image_data_size);
-
-    RPNG_LOG("INFO: IDAT data decompressed: %i -> %i\n", image_data_size, image_data_decomp_size);
-
-    if ((image_data_filtered != NULL) && (image_data_decomp_size > 0))
+    // Strategies: scanlines filter type (-2: filter trials, -1: best filter heuristic) and deflate level
+    // NOTE: No filtering is usually better for screenshots and flat color images, filter trials for
+    // small sprites and photos, run-length only matching for smooth gradients
+    static const int filter_types[5] = { -2, -1, 0, 4, -2 };
+    static const int levels[5] = { RPNG_MAX_COMPRESSION_LEVEL, RPNG_MAX_COMPRESSION_LEVEL, RPNG_MAX_COMPRESSION_LEVEL,
+                                   RPNG_MAX_RLE_COMPRESSION_LEVEL, RPNG_MAX_RLE_COMPRESSION_LEVEL };
+    const int strategy_count = 5;
+
+    char *comp_data[5] = { 0 };
+    int comp_data_size[5] = { 0 };
+    int best = -1;
+    (void)image_data_size;
+
+    rpng_deflate_strategy_job job = { 0 };
+    job.image_data = image_data;
+    job.width = width;
+    job.height = height;
+    job.pixel_size = pixel_size;
+    job.filter_types = filter_types;
+    job.levels = levels;
+    job.comp_data = comp_data;
+    job.comp_data_size = comp_data_size;
+
+    unsigned int data_filtered_size = (width*pixel_size + 1)*height;
+    int thread_count = (data_filtered_size < 2*RPNG_DEFLATE_CHUNK_SIZE)? rpng_get_thread_count(strategy_count) : 1;
+
+    if (thread_count > 1) rpng_parallel_for(rpng_deflate_strategy_job_func, &job, strategy_count, thread_count);
+
+    // Keep smallest compressed data, first strategy wins on same size (deterministic)
+    for (int i = 0; i < strategy_count; i++)
     {
-        // Now we have the data decompressed but every scanline of the image was originally filtered for
-        // maximum compression and one extra byte with the filter type was added to every scanline
-        // We must undo that image prefiltering for every scanline
-
-        // Image data reverse pre-processing for filter type
-        //int pixel_size = *color_channels*(*bit_depth/8);
-        int scanline_size = width*pixel_size;
-        image_data_unfiltered = (char *)RPNG_CALLOC(image_data_decomp_size, 1);  // Actually data unfiltered size should be smaller
+        if (thread_count == 1) rpng_deflate_strategy_job_func(&job, i, 0);
 
-        int current_filter = 0;
-        int out = 0, x = 0, a = 0, b = 0, c = 0;
-
-        // Reverse scanlines filters
-        for (int y = 0; y < height; y++)   // Move scanline by scanline, we must discard first byte = current_filter
+        if ((comp_data[i] != NULL) && (comp_data_size[i] > 0) && ((best == -1) || (comp_data_size[i] < comp_data_size[best])))
         {
-            current_filter = (int)image_data_filtered[(1 + scanline_size)*y];
-
-            for (int p = 0; p < scanline_size; p++)
-            {
-                // x = current byte
-                // a = left pixel byte (from current)
-                // b = above pixel byte (from current)
-                // c = left pixel byte (from b)
-                x = (int)(image_data_filtered[(1 + scanline_size)*y + 1 + p]);
-                a = (p >= pixel_size) ? (int)(image_data_unfiltered[scanline_size*y + p - pixel_size]) : 0;
-                b = (y > 0) ? (int)(image_data_unfiltered[scanline_size*(y - 1) + p]) : 0;
-                c = (y > 0) ? ((p >= pixel_size) ? (int)(image_data_unfiltered[scanline_size*(y - 1) + p - pixel_size]) : 0) : 0;
-
-                switch (current_filter)
-                {
-                    case 0: out = x; break;         // Filter type 0: None (Usually used for indexed images)
-                    case 1: out = x + a; break;     // Filter type 1: Sub
-                    case 2: out = x + b; break;     // Filter type 2: Up
-                    case 3: out = x + ((a + b)>>1); break;    // Filter type 3: Average
-                    case 4: out = x + rpng_paeth_predictor(a, b, c); break;  // Filter type 4: Paeth
-                    default: break;
-                }
-
-                // Register scanline unfiltered values, byte by byte
-                image_data_unfiltered[y*scanline_size + p] = (char)out;
-            }
+            if (best != -1) RPNG_FREE(comp_data[best]);
+            best = i;
         }
-
-        RPNG_FREE(image_data_filtered);
+        else RPNG_FREE(comp_data[i]);
     }
 
-    return image_data_unfiltered;
+    if (best == -1) return NULL;
+
+    RPNG_LOG("INFO: Image data deflating strategy %i chosen: %i bytes\n", best, comp_data_size[best]);
+
+    *output_size = comp_data_size[best];
+    return comp_data[best];
 }
 
-// Swap integer from big<->little endian
-static unsigned int swap_endian(unsigned int value)
+// Prefilter and compress image data with one strategy, parallel job function
+static void rpng_deflate_strategy_job_func(void *data, int index, int thread)
 {
-    // Swap endian (big to little) or (little to big)
-    unsigned int b0, b1, b2, b3;
-    unsigned int res;
+    rpng_deflate_strategy_job *job = (rpng_deflate_strategy_job *)data;
+    (void)thread;
 
-    b0 = (value & 0x000000ff) << 24u;
-    b1 = (value & 0x0000ff00) << 8u;
-    b2 = (value & 0x00ff0000) >> 8u;
+    job->comp_data[index] = rpng_deflate_image_data(job->image_data, job->width*job->height*job->pixel_size, job->width, job->height,
+        job->pixel_size, &job->comp_data_size[index], job->filter_types[index], job->levels[index]);
+}
+
+// Get scanlines filter type (-1: best filter for every scanline, -2: filter trials) and deflate level for an encode profile
+static void rpng_get_encode_settings(int encode_profile, int *filter_type, int *level)
+{
+    switch (encode_profile)
+    {
+        case RPNG_ENCODE_MAX:
+        {
+            // NOTE: Only one strategy is used on streaming (no multiple deflate passes)
+            *filter_type = -2;
+            *level = RPNG_MAX_COMPRESSION_LEVEL;
+        } break;
+        case RPNG_ENCODE_FAST:
+        {
+            // NOTE: Paeth filter leaves runs of zeros on flat and gradient areas (SIMD filtered),
+            // runs are compressed as matches with previous byte, no hash chains search
+            *filter_type = 4;
+            *level = RPNG_FAST_COMPRESSION_LEVEL;
+        } break;
+        case RPNG_ENCODE_BALANCED:
+        default:
+        {
+            *filter_type = -1;
+            *level = RPNG_COMPRESSION_LEVEL;
+        } break;
+    }
+}
+
+#if defined(RPNG_SIMD_SSE2)
+// Accumulate the absolute values of 16 signed bytes into sum (2x64bit lanes)
+static __m128i rpng_sse2_sum_abs(__m128i sum, __m128i value)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i sign = _mm_cmpgt_epi8(zero, value);
+    __m128i abs_value = _mm_sub_epi8(_mm_xor_si128(value, sign), sign);   // NOTE: -128 results in 128 (unsigned)
+
+    return _mm_add_epi64(sum, _mm_sad_epu8(abs_value, zero));
+}
+
+// Paeth predictor for 8 values (16bit lanes), same selection order than rpng_paeth_predictor()
+static __m128i rpng_sse2_paeth_predictor(__m128i a, __m128i b, __m128i c)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i pa = _mm_sub_epi16(b, c);       // p - a = b - c
+    __m128i pb = _mm_sub_epi16(a, c);       // p - b = a - c
+    __m128i pc = _mm_add_epi16(pa, pb);     // p - c = a + b - 2c
+
+    pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+    pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+    pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+    // Predictor: (pa is smallest)? a : ((pb is smallest)? b : c)
+    __m128i smallest = _mm_min_epi16(pa, _mm_min_epi16(pb, pc));
+    __m128i use_b = _mm_cmpeq_epi16(smallest, pb);
+    __m128i use_a = _mm_cmpeq_epi16(smallest, pa);
+    __m128i pr = _mm_or_si128(_mm_and_si128(use_b, b), _mm_andnot_si128(use_b, c));
+
+    return _mm_or_si128(_mm_and_si128(use_a, a), _mm_andnot_si128(use_a, pr));
+}
+#endif
+
+#if defined(RPNG_SIMD_NEON)
+// Accumulate the absolute values of 16 signed bytes into sum (4x32bit lanes)
+static uint32x4_t rpng_neon_sum_abs(uint32x4_t sum, uint8x16_t value)
+{
+    uint8x16_t abs_value = vreinterpretq_u8_s8(vabsq_s8(vreinterpretq_s8_u8(value)));    // NOTE: -128 results in 128 (unsigned)
+
+    return vpadalq_u16(sum, vpaddlq_u8(abs_value));
+}
+
+// Paeth predictor for 8 values (16bit lanes), same selection order than rpng_paeth_predictor()
+static uint8x8_t rpng_neon_paeth_predictor(uint8x8_t a, uint8x8_t b, uint8x8_t c)
+{
+    int16x8_t a16 = vreinterpretq_s16_u16(vmovl_u8(a));
+    int16x8_t b16 = vreinterpretq_s16_u16(vmovl_u8(b));
+    int16x8_t c16 = vreinterpretq_s16_u16(vmovl_u8(c));
+
+    int16x8_t pa = vsubq_s16(b16, c16);     // p - a = b - c
+    int16x8_t pb = vsubq_s16(a16, c16);     // p - b = a - c
+    int16x8_t pc = vabsq_s16(vaddq_s16(pa, pb));    // p - c = a + b - 2c
+    pa = vabsq_s16(pa);
+    pb = vabsq_s16(pb);
+
+    // Predictor: (pa is smallest)? a : ((pb is smallest)? b : c)
+    int16x8_t smallest = vminq_s16(pa, vminq_s16(pb, pc));
+    uint8x8_t use_a = vmovn_u16(vceqq_s16(smallest, pa));
+    uint8x8_t use_b = vmovn_u16(vceqq_s16(smallest, pb));
+
+    return vbsl_u8(use_a, a, vbsl_u8(use_b, b, c));
+}
+
+// Add the 4x32bit lanes of sum
+static unsigned int rpng_neon_sum_lanes(uint32x4_t sum)
+{
+    uint64x2_t sum64 = vpaddlq_u32(sum);
+
+    return (unsigned int)(vgetq_lane_u64(sum64, 0) + vgetq_lane_u64(sum64, 1));
+}
+#endif
+
+// Filter one scanline with requested filter type, returns the sum of absolute values of outputs (as signed bytes)
+// NOTE: Every filter type processes the full scanline in a single loop, without per-byte filter/bounds checks:
+//  - First pixel of the scanline has no left neighbour (a = c = 0), it is processed before the main loop
+//  - Previous scanline (b, c) for the first image scanline is expected to be a zeroed scanline
+//  - When SIMD is available, 16 bytes are processed at once, remaining bytes are processed one by one
+static unsigned int rpng_filter_scanline(unsigned char *output, const unsigned char *row, const unsigned char *prev, int size, int pixel_size, int filter_type)
+{
+    unsigned int sum = 0;
+    int p = 0;
+
+    // Left neighbour bytes (a, c) are only available after first pixel
+    int first = (pixel_size < size)? pixel_size : size;
+
+#if defined(RPNG_SIMD_SSE2)
+    __m128i sum_simd = _mm_setzero_si128();
+#elif defined(RPNG_SIMD_NEON)
+    uint32x4_t sum_simd = vdupq_n_u32(0);
+#endif
+
+    switch (filter_type)
+    {
+        case 0:     // Filter type 0: None
+        {
+            memcpy(output, row, size);
+
+        #if defined(RPNG_SIMD_SSE2)
+            for (; p + 16 <= size; p += 16) sum_simd = rpng_sse2_sum_abs(sum_simd, _mm_loadu_si128((const __m128i *)(row + p)));
+        #elif defined(RPNG_SIMD_NEON)
+            for (; p + 16 <= size; p += 16) sum_simd = rpng_neon_sum_abs(sum_simd, vld1q_u8(row + p));
+        #endif
+            for (; p < size; p++) sum += abs((signed char)row[p]);
+        } break;
+        case 1:     // Filter type 1: Sub
+        {
+            for (; p < first; p++) { output[p] = row[p]; sum += abs((signed char)output[p]); }
+
+        #if defined(RPNG_SIMD_SSE2)
+            for (; p + 16 <= size; p += 16)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)(row + p));
+                __m128i a = _mm_loadu_si128((const __m128i *)(row + p - pixel_size));
+                __m128i out = _mm_sub_epi8(x, a);
+
+                _mm_storeu_si128((__m128i *)(output + p), out);
+                sum_simd = rpng_sse2_sum_abs(sum_simd, out);
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            for (; p + 16 <= size; p += 16)
+            {
+                uint8x16_t out = vsubq_u8(vld1q_u8(row + p), vld1q_u8(row + p - pixel_size));
+
+                vst1q_u8(output + p, out);
+                sum_simd = rpng_neon_sum_abs(sum_simd, out);
+            }
+        #endif
+            for (; p < size; p++) { output[p] = (unsigned char)(row[p] - row[p - pixel_size]); sum += abs((signed char)output[p]); }
+        } break;
+        case 2:     // Filter type 2: Up
+        {
+        #if defined(RPNG_SIMD_SSE2)
+            for (; p + 16 <= size; p += 16)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)(row + p));
+                __m128i b = _mm_loadu_si128((const __m128i *)(prev + p));
+                __m128i out = _mm_sub_epi8(x, b);
+
+                _mm_storeu_si128((__m128i *)(output + p), out);
+                sum_simd = rpng_sse2_sum_abs(sum_simd, out);
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            for (; p + 16 <= size; p += 16)
+            {
+                uint8x16_t out = vsubq_u8(vld1q_u8(row + p), vld1q_u8(prev + p));
+
+                vst1q_u8(output + p, out);
+                sum_simd = rpng_neon_sum_abs(sum_simd, out);
+            }
+        #endif
+            for (; p < size; p++) { output[p] = (unsigned char)(row[p] - prev[p]); sum += abs((signed char)output[p]); }
+        } break;
+        case 3:     // Filter type 3: Average
+        {
+            for (; p < first; p++) { output[p] = (unsigned char)(row[p] - (prev[p]>>1)); sum += abs((signed char)output[p]); }
+
+        #if defined(RPNG_SIMD_SSE2)
+            for (; p + 16 <= size; p += 16)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)(row + p));
+                __m128i a = _mm_loadu_si128((const __m128i *)(row + p - pixel_size));
+                __m128i b = _mm_loadu_si128((const __m128i *)(prev + p));
+
+                // NOTE: _mm_avg_epu8() rounds up, (a + b)>>1 requires rounding down
+                __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+                __m128i out = _mm_sub_epi8(x, avg);
+
+                _mm_storeu_si128((__m128i *)(output + p), out);
+                sum_simd = rpng_sse2_sum_abs(sum_simd, out);
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            for (; p + 16 <= size; p += 16)
+            {
+                uint8x16_t avg = vhaddq_u8(vld1q_u8(row + p - pixel_size), vld1q_u8(prev + p));   // NOTE: Halving add, rounds down
+                uint8x16_t out = vsubq_u8(vld1q_u8(row + p), avg);
+
+                vst1q_u8(output + p, out);
+                sum_simd = rpng_neon_sum_abs(sum_simd, out);
+            }
+        #endif
+            for (; p < size; p++) { output[p] = (unsigned char)(row[p] - ((row[p - pixel_size] + prev[p])>>1)); sum += abs((signed char)output[p]); }
+        } break;
+        case 4:     // Filter type 4: Paeth
+        {
+            // NOTE: With no left neighbour (a = c = 0), Paeth predictor is always b
+            for (; p < first; p++) { output[p] = (unsigned char)(row[p] - prev[p]); sum += abs((signed char)output[p]); }
+
+        #if defined(RPNG_SIMD_SSE2)
+            __m128i zero = _mm_setzero_si128();
+
+            for (; p + 16 <= size; p += 16)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)(row + p));
+                __m128i a = _mm_loadu_si128((const __m128i *)(row + p - pixel_size));
+                __m128i b = _mm_loadu_si128((const __m128i *)(prev + p));
+                __m128i c = _mm_loadu_si128((const __m128i *)(prev + p - pixel_size));
+
+                // Paeth predictor requires 16bit precision, computed in two halves
+                __m128i pr_lo = rpng_sse2_paeth_predictor(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(c, zero));
+                __m128i pr_hi = rpng_sse2_paeth_predictor(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(c, zero));
+                __m128i out = _mm_sub_epi8(x, _mm_packus_epi16(pr_lo, pr_hi));
+
+                _mm_storeu_si128((__m128i *)(output + p), out);
+                sum_simd = rpng_sse2_sum_abs(sum_simd, out);
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            for (; p + 16 <= size; p += 16)
+            {
+                uint8x16_t a = vld1q_u8(row + p - pixel_size);
+                uint8x16_t b = vld1q_u8(prev + p);
+                uint8x16_t c = vld1q_u8(prev + p - pixel_size);
+
+                // Paeth predictor requires 16bit precision, computed in two halves
+                uint8x16_t pr = vcombine_u8(rpng_neon_paeth_predictor(vget_low_u8(a), vget_low_u8(b), vget_low_u8(c)),
+                                            rpng_neon_paeth_predictor(vget_high_u8(a), vget_high_u8(b), vget_high_u8(c)));
+                uint8x16_t out = vsubq_u8(vld1q_u8(row + p), pr);
+
+                vst1q_u8(output + p, out);
+                sum_simd = rpng_neon_sum_abs(sum_simd, out);
+            }
+        #endif
+            for (; p < size; p++) { output[p] = (unsigned char)(row[p] - rpng_paeth_predictor(row[p - pixel_size], prev[p], prev[p - pixel_size])); sum += abs((signed char)output[p]); }
+        } break;
+        default: break;
+    }
+
+#if defined(RPNG_SIMD_SSE2)
+    sum += (unsigned int)(_mm_cvtsi128_si32(sum_simd) + _mm_cvtsi128_si32(_mm_srli_si128(sum_simd, 8)));
+#elif defined(RPNG_SIMD_NEON)
+    sum += rpng_neon_sum_lanes(sum_simd);
+#endif
+
+    return sum;
+}
+
+// Filter a band of scanlines [y_start..y_end) using thread buffers, choosing best filter for every scanline if required
+static void rpng_filter_scanlines(const rpng_filter_job *job, int y_start, int y_end, int thread)
+{
+    unsigned char *filter_scanlines = (job->filter_scanlines != NULL)? job->filter_scanlines + 4*job->scanline_size*thread : NULL;
+
+    for (int y = y_start; y < y_end; y++)
+    {
+        const unsigned char *row = job->image_data + (size_t)job->scanline_size*y;
+        const unsigned char *prev = (y > 0)? row - job->scanline_size : job->zero_scanline;
+        unsigned char *output = job->data_filtered + (size_t)(job->scanline_size + 1)*y;
+
+        if (job->forced_filter_type == -2)
+        {
+            // Previous filtered scanlines of the band are used as context
+            int context_size = (job->scanline_size + 1)*(y - y_start);
+            if (context_size > RPNG_FILTER_TRIAL_CONTEXT) context_size = RPNG_FILTER_TRIAL_CONTEXT;
+
+            rpng_filter_row_trials(output, row, prev, job->scanline_size, job->pixel_size, context_size, job->trial_states + thread, job->trial_data + (size_t)job->trial_data_size*thread);
+        }
+        else rpng_filter_row(output, row, prev, job->scanline_size, job->pixel_size, job->forced_filter_type, filter_scanlines);
+    }
+}
+
+// Filter one scanline, choosing best filter if required, output includes filter type byte
+static void rpng_filter_row(unsigned char *output, const unsigned char *row, const unsigned char *prev, int scanline_size, int pixel_size, int forced_filter_type, unsigned char *filter_scanlines)
+{
+    int best_filter = 0;
+
+    if (forced_filter_type == -1)
+    {
+        // Choose the best filter type for every scanline
+        // REF: https://www.w3.org/TR/PNG-Encoders.html#E.Filter-selection
+        // Heuristic: Compute the output scanline using all five filters,
+        // select the filter that gives the smallest sum of absolute values of outputs
+        // NOTE: Considering the output bytes as signed differences for the test
+        // NOTE: Filter None is written directly to output, other filters are kept in
+        // candidate scanlines and the best one is just copied, no need to filter it again
+        unsigned int best_value = rpng_filter_scanline(output + 1, row, prev, scanline_size, pixel_size, 0);
+
+        for (int filter = 1; filter < 5; filter++)
+        {
+            unsigned int value = rpng_filter_scanline(filter_scanlines + scanline_size*(filter - 1), row, prev, scanline_size, pixel_size, filter);
+
+            if (value < best_value)
+            {
+                best_value = value;
+                best_filter = filter;
+            }
+        }
+
+        if (best_filter > 0) memcpy(output + 1, filter_scanlines + scanline_size*(best_filter - 1), scanline_size);
+    }
+    else
+    {
+        if ((forced_filter_type >= 0) && (forced_filter_type <= 4)) best_filter = forced_filter_type;
+
+        // Apply the requested filter to scanline
+        rpng_filter_scanline(output + 1, row, prev, scanline_size, pixel_size, best_filter);
+    }
+
+    // Register scanline filter byte
+    output[0] = (unsigned char)best_filter;
+}
+
+// Filter one scanline trying all filter types, smallest compressed candidate is chosen, output includes filter type byte
+// NOTE: Every candidate is compressed after previous filtered data (context_size bytes just before output),
+// so matches with previous scanlines are considered, trial_data size must be sdefl_bound(context_size + scanline_size + 1)
+static void rpng_filter_row_trials(unsigned char *output, const unsigned char *row, const unsigned char *prev, int scanline_size, int pixel_size, int context_size, struct sdefl *sde, unsigned char *trial_data)
+{
+    int best_filter = 0;
+    int best_size = 0;
+
+    for (int filter = 0; filter < 5; filter++)
+    {
+        output[0] = (unsigned char)filter;
+        rpng_filter_scanline(output + 1, row, prev, scanline_size, pixel_size, filter);
+
+        int size = sdeflate(sde, trial_data, output - context_size, context_size + scanline_size + 1, RPNG_FILTER_TRIAL_LEVEL);
+
+        // NOTE: Lowest filter type wins on same size (deterministic)
+        if ((filter == 0) || (size < best_size))
+        {
+            best_size = size;
+            best_filter = filter;
+        }
+    }
+
+    // Last candidate (Paeth) is already in output, otherwise best candidate is filtered again
+    if (best_filter < 4) rpng_filter_scanline(output + 1, row, prev, scanline_size, pixel_size, best_filter);
+    output[0] = (unsigned char)best_filter;
+}
+
+// Filter one band of scanlines, parallel job function
+static void rpng_filter_scanlines_job(void *data, int index, int thread)
+{
+    const rpng_filter_job *job = (const rpng_filter_job *)data;
+    int y_start = index*job->band_height;
+    int y_end = (y_start + job->band_height < job->height)? y_start + job->band_height : job->height;
+
+    rpng_filter_scanlines(job, y_start, y_end, thread);
+}
+
+// Verify one chunk CRC32, parallel job function
+static void rpng_crc32_check_job_func(void *data, int index, int thread)
+{
+    rpng_crc32_check_job *job = (rpng_crc32_check_job *)data;
+    unsigned int crc = compute_chunk_crc32(job->chunks[index].type, job->chunks[index].data, job->chunks[index].length);
+    (void)thread;
+
+    // Check computed CRC matches provided CRC
+    // NOTE: Chunks CRC is stored in host byte order when read
+    job->chunks_valid[index] = (job->chunks[index].crc == crc);
+}
+
+// Run job function for all job indices assigned to one thread
+static void rpng_job_run(rpng_job *job)
+{
+    for (int i = job->thread; i < job->count; i += job->thread_count) job->func(job->data, i, job->thread);
+}
+
+#if defined(RPNG_THREADS_WIN32)
+static unsigned int __stdcall rpng_job_thread(void *arg) { rpng_job_run((rpng_job *)arg); return 0; }
+#elif defined(RPNG_THREADS_PTHREAD)
+static void *rpng_job_thread(void *arg) { rpng_job_run((rpng_job *)arg); return NULL; }
+#endif
+
+// Run job function for every index in [0..count) using multiple threads (if available)
+// NOTE: Indices are statically interleaved between threads (deterministic), calling thread processes
+// the indices of thread 0, in case a thread can not be created its indices are processed by calling thread
+static void rpng_parallel_for(rpng_job_func func, void *data, int count, int thread_count)
+{
+    if (thread_count > RPNG_MAX_THREADS) thread_count = RPNG_MAX_THREADS;
+    if (thread_count > count) thread_count = count;
+    if (thread_count < 1) thread_count = 1;
+
+    rpng_job jobs[RPNG_MAX_THREADS] = { 0 };
+    bool running[RPNG_MAX_THREADS] = { 0 };
+#if defined(RPNG_THREADS_WIN32)
+    uintptr_t threads[RPNG_MAX_THREADS] = { 0 };
+#elif defined(RPNG_THREADS_PTHREAD)
+    pthread_t threads[RPNG_MAX_THREADS];
+#endif
+
+    for (int t = 0; t < thread_count; t++)
+    {
+        jobs[t].func = func;
+        jobs[t].data = data;
+        jobs[t].count = count;
+        jobs[t].thread = t;
+        jobs[t].thread_count = thread_count;
+
+    #if defined(RPNG_THREADS_WIN32)
+        if (t > 0)
+        {
+            threads[t] = _beginthreadex(NULL, 0, rpng_job_thread, &jobs[t], 0, NULL);
+            running[t] = (threads[t] != 0);
+        }
+    #elif defined(RPNG_THREADS_PTHREAD)
+        if (t > 0) running[t] = (pthread_create(&threads[t], NULL, rpng_job_thread, &jobs[t]) == 0);
+    #endif
+    }
+
+    for (int t = 0; t < thread_count; t++)
+    {
+        if (!running[t]) rpng_job_run(&jobs[t]);
+    }
+
+    for (int t = 1; t < thread_count; t++)
+    {
+        if (running[t])
+        {
+        #if defined(RPNG_THREADS_WIN32)
+            WaitForSingleObject((void *)threads[t], 0xFFFFFFFF);  // INFINITE
+            CloseHandle((void *)threads[t]);
+        #elif defined(RPNG_THREADS_PTHREAD)
+            pthread_join(threads[t], NULL);
+        #endif
+        }
+    }
+}
+
+// Get number of threads to use for a number of jobs
+// NOTE: Limited by RPNG_MAX_THREADS and available CPU cores
+static int rpng_get_thread_count(int job_count)
+{
+    int thread_count = 1;
+
+#if defined(RPNG_THREADS_WIN32)
+    const char *cores = getenv("NUMBER_OF_PROCESSORS");
+    if (cores != NULL) thread_count = atoi(cores);
+#elif defined(RPNG_THREADS_PTHREAD) && defined(_SC_NPROCESSORS_ONLN)
+    thread_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (thread_count > RPNG_MAX_THREADS) thread_count = RPNG_MAX_THREADS;
+    if (thread_count > job_count) thread_count = job_count;
+    if (thread_count < 1) thread_count = 1;
+
+    return thread_count;
+}
+
+// Read image info from PNG data IHDR chunk, returns false if image format is not supported
+// NOTE: IHDR must be the first chunk: signature (8) + length (4) + type (4) + data (13) + CRC32 (4)
+static bool rpng_read_image_info(const char *buffer, int buffer_size, rpng_image_info *info)
+{
+    if ((buffer == NULL) || (buffer_size < 33) || (memcmp(buffer, png_signature, 8) != 0)) return false;
+    if ((read_uint32_be(buffer + 8) != 13) || (memcmp(buffer + 12, "IHDR", 4) != 0)) return false;
+
+    if (compute_chunk_crc32(buffer + 12, buffer + 16, 13) != read_uint32_be(buffer + 29))
+    {
+        RPNG_LOG("WARNING: CRC not valid, IHDR chunk image info could be corrupted\n");
+        return false;
+    }
+
+    const unsigned char *data = (const unsigned char *)buffer + 16;
+
+    info->width = (int)read_uint32_be(buffer + 16);
+    info->height = (int)read_uint32_be(buffer + 20);
+    info->bit_depth = data[8];
+    info->color_type = data[9];
+
+    info->color_channels = 0;
+    switch (info->color_type)
+    {
+        case 0: info->color_channels = 1; break;     // Pixel format: 0-Grayscale
+        case 4: info->color_channels = 2; break;     // Pixel format: 4-GrayAlpha
+        case 2: info->color_channels = 3; break;     // Pixel format: 2-RGB
+        case 6: info->color_channels = 4; break;     // Pixel format: 6-RGBA
+        case 3: info->color_channels = 1; break;     // Pixel format: 3-Indexed (1 channel containing 8-bit indexed data)
+        default: break;
+    }
+
+    // TODO: Support bit depths of 1/2/4 bits? -> Convert to 8bit grayscale
+    // TODO: Support interlaced images (Adam7)
+    if ((info->color_channels == 0) ||
+        ((info->bit_depth != 8) && (info->bit_depth != 16)) ||
+        ((info->color_type == 3) && (info->bit_depth != 8)) ||
+        (data[10] != 0) || (data[11] != 0) || (data[12] != 0))  // Compression: 0 (deflate), Filter: 0 (default), Interlace: 0 (none)
+    {
+        RPNG_LOG("WARNING: Failed to load file, image pixel format not supported\n");
+        return false;
+    }
+
+    info->pixel_size = info->color_channels*(info->bit_depth/8);
+
+    // Image data (filtered) must fit into an int sized buffer
+    if ((info->width <= 0) || (info->height <= 0) ||
+        (((long long)info->width*info->pixel_size + 1)*info->height > 0x7fffffff))
+    {
+        RPNG_LOG("WARNING: Failed to load file, image size not supported\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Decode image data from PNG data (IDAT chunks -> output), output size must be width*height*pixel_size
+// NOTE: Every IDAT chunk CRC32 is validated, one single IDAT chunk is decompressed directly from PNG data (no copy),
+// multiple IDAT chunks are joined before decompression
+static int rpng_decode_image_data(const char *buffer, int buffer_size, const rpng_image_info *info, unsigned char *output)
+{
+    int offset = 8;     // Skip signature
+    int idat_count = 0;
+    int idat_size = 0;
+    int idat_offset = 0;
+    bool iend_found = false;
+
+    // Find IDAT chunks, verifying chunks are inside buffer bounds
+    while (!iend_found && ((buffer_size - offset) >= 12))
+    {
+        unsigned int chunk_size = read_uint32_be(buffer + offset);
+
+        if (chunk_size > (unsigned int)(buffer_size - offset - 12)) break;    // WARNING: Chunk data out of bounds
+
+        if (memcmp(buffer + offset + 4, "IDAT", 4) == 0)
+        {
+            if (compute_chunk_crc32(buffer + offset + 4, buffer + offset + 8, chunk_size) != read_uint32_be(buffer + offset + 8 + chunk_size))
+            {
+                RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
+                return RPNG_ERROR_IMAGE_DATA;
+            }
+
+            if (chunk_size > (unsigned int)(0x7fffffff - idat_size)) break;    // WARNING: Image data too big
+
+            if (idat_count == 0) idat_offset = offset;
+            idat_size += chunk_size;
+            idat_count++;
+        }
+        else if (memcmp(buffer + offset + 4, "IEND", 4) == 0) iend_found = true;
+
+        offset += (4 + 4 + chunk_size + 4);     // Skip chunk Length + FOURCC + chunk data + CRC32
+    }
+
+    if (!iend_found || (idat_count == 0))
+    {
+        RPNG_LOG("WARNING: IDAT image data not found or PNG data not complete\n");
+        return RPNG_ERROR_IMAGE_DATA;
+    }
+
+    int result = RPNG_SUCCESS;
+
+    if (idat_count == 1) result = rpng_inflate_image_data((const unsigned char *)buffer + idat_offset + 8, idat_size, info, output);
+    else
+    {
+        unsigned char *idat_data = (unsigned char *)RPNG_MALLOC(idat_size);
+
+        if (idat_data != NULL)
+        {
+            int idat_data_size = 0;
+
+            for (offset = idat_offset; idat_data_size < idat_size; )
+            {
+                unsigned int chunk_size = read_uint32_be(buffer + offset);
+
+                if (memcmp(buffer + offset + 4, "IDAT", 4) == 0)
+                {
+                    memcpy(idat_data + idat_data_size, buffer + offset + 8, chunk_size);
+                    idat_data_size += chunk_size;
+                }
+
+                offset += (4 + 4 + chunk_size + 4);
+            }
+
+            result = rpng_inflate_image_data(idat_data, idat_size, info, output);
+            RPNG_FREE(idat_data);
+        }
+        else result = RPNG_ERROR_MEMORY_ALLOC;
+    }
+
+    return result;
+}
+
+// Decompress and unfilter image data (IDAT chunk.data -> output), output size must be width*height*pixel_size
+// NOTE: Filtered data is decompressed once into an exact size buffer (scanlines + filter type bytes),
+// scanlines are unfiltered one by one directly into output, previous output scanline is used as reference
+static int rpng_inflate_image_data(const unsigned char *comp_data, int comp_data_size, const rpng_image_info *info, unsigned char *output)
+{
+    int result = RPNG_SUCCESS;
+    int scanline_size = info->width*info->pixel_size;
+    int data_filtered_size = (scanline_size + 1)*info->height;
+
+    unsigned char *data_filtered = (unsigned char *)RPNG_MALLOC(data_filtered_size);
+    unsigned char *zero_scanline = (unsigned char *)RPNG_CALLOC(scanline_size, 1);
+
+    if ((data_filtered == NULL) || (zero_scanline == NULL))
+    {
+        RPNG_FREE(data_filtered);
+        RPNG_FREE(zero_scanline);
+        return RPNG_ERROR_MEMORY_ALLOC;
+    }
+
+    // Decompress IDAT chunk data
+    int data_decomp_size = zsinflate(data_filtered, data_filtered_size, comp_data, comp_data_size);
+
+    RPNG_LOG("INFO: IDAT data decompressed: %i -> %i\n", comp_data_size, data_decomp_size);
+
+    if (data_decomp_size == data_filtered_size)
+    {
+        // Every scanline of the image was originally filtered for maximum compression and
+        // one extra byte with the filter type was added to every scanline, we must undo that filtering
+        for (int y = 0; y < info->height; y++)
+        {
+            const unsigned char *filtered = data_filtered + (size_t)(scanline_size + 1)*y;
+            const unsigned char *prev = (y > 0)? output + (size_t)scanline_size*(y - 1) : zero_scanline;
+
+            if (filtered[0] > 4)
+            {
+                RPNG_LOG("WARNING: IDAT image data scanline filter type not valid\n");
+                result = RPNG_ERROR_IMAGE_DATA;
+                break;
+            }
+
+            rpng_unfilter_scanline(output + (size_t)scanline_size*y, filtered + 1, prev, scanline_size, info->pixel_size, filtered[0]);
+        }
+    }
+    else
+    {
+        RPNG_LOG("WARNING: IDAT image data decompression failed\n");
+        result = RPNG_ERROR_IMAGE_DATA;
+    }
+
+    RPNG_FREE(data_filtered);
+    RPNG_FREE(zero_scanline);
+
+    return result;
+}
+
+#if defined(RPNG_SIMD_SSE2)
+// Load one pixel (3 or 4 bytes) into the low bytes of a SIMD register
+static __m128i rpng_sse2_load_pixel(const unsigned char *pixel, int pixel_size)
+{
+    int value = 0;
+    memcpy(&value, pixel, pixel_size);
+
+    return _mm_cvtsi32_si128(value);
+}
+
+// Store one pixel (3 or 4 bytes) from the low bytes of a SIMD register
+static void rpng_sse2_store_pixel(unsigned char *pixel, __m128i value, int pixel_size)
+{
+    int result = _mm_cvtsi128_si32(value);
+    memcpy(pixel, &result, pixel_size);
+}
+#endif
+
+#if defined(RPNG_SIMD_NEON)
+// Load one pixel (3 or 4 bytes) into the low bytes of a SIMD register
+static uint8x8_t rpng_neon_load_pixel(const unsigned char *pixel, int pixel_size)
+{
+    unsigned char value[8] = { 0 };
+    memcpy(value, pixel, pixel_size);
+
+    return vld1_u8(value);
+}
+
+// Store one pixel (3 or 4 bytes) from the low bytes of a SIMD register
+static void rpng_neon_store_pixel(unsigned char *pixel, uint8x8_t value, int pixel_size)
+{
+    unsigned char result[8];
+    vst1_u8(result, value);
+    memcpy(pixel, result, pixel_size);
+}
+#endif
+
+// Unfilter one scanline with provided filter type, previous scanline must be already unfiltered
+// NOTE: Previous scanline for the first image scanline is expected to be a zeroed scanline
+//  - Up filter processes 16 bytes at once when SIMD is available
+//  - Sub, Average and Paeth filters depend on the left pixel, when SIMD is available,
+//    RGB/RGBA 8bit pixels (3/4 bytes) are processed one pixel at once, other pixel sizes are processed byte by byte
+static void rpng_unfilter_scanline(unsigned char *output, const unsigned char *filtered, const unsigned char *prev, int size, int pixel_size, int filter_type)
+{
+    int i = 0;
+
+#if defined(RPNG_SIMD_SSE2) || defined(RPNG_SIMD_NEON)
+    bool pixel_simd = ((pixel_size == 3) || (pixel_size == 4));
+#endif
+
+    switch (filter_type)
+    {
+        case 0: memcpy(output, filtered, size); break;      // Filter type 0: None (Usually used for indexed images)
+        case 1:     // Filter type 1: Sub
+        {
+        #if defined(RPNG_SIMD_SSE2)
+            if (pixel_simd)
+            {
+                __m128i a = _mm_setzero_si128();
+                for (; i < size; i += pixel_size)
+                {
+                    a = _mm_add_epi8(rpng_sse2_load_pixel(filtered + i, pixel_size), a);
+                    rpng_sse2_store_pixel(output + i, a, pixel_size);
+                }
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            if (pixel_simd)
+            {
+                uint8x8_t a = vdup_n_u8(0);
+                for (; i < size; i += pixel_size)
+                {
+                    a = vadd_u8(rpng_neon_load_pixel(filtered + i, pixel_size), a);
+                    rpng_neon_store_pixel(output + i, a, pixel_size);
+                }
+            }
+        #endif
+            for (; i < pixel_size; i++) output[i] = filtered[i];
+            for (; i < size; i++) output[i] = (unsigned char)(filtered[i] + output[i - pixel_size]);
+        } break;
+        case 2:     // Filter type 2: Up
+        {
+        #if defined(RPNG_SIMD_SSE2)
+            for (; i <= (size - 16); i += 16)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)(filtered + i));
+                __m128i b = _mm_loadu_si128((const __m128i *)(prev + i));
+                _mm_storeu_si128((__m128i *)(output + i), _mm_add_epi8(x, b));
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            for (; i <= (size - 16); i += 16) vst1q_u8(output + i, vaddq_u8(vld1q_u8(filtered + i), vld1q_u8(prev + i)));
+        #endif
+            for (; i < size; i++) output[i] = (unsigned char)(filtered[i] + prev[i]);
+        } break;
+        case 3:     // Filter type 3: Average
+        {
+        #if defined(RPNG_SIMD_SSE2)
+            if (pixel_simd)
+            {
+                __m128i a = _mm_setzero_si128();
+                __m128i one = _mm_set1_epi8(1);
+                for (; i < size; i += pixel_size)
+                {
+                    // NOTE: _mm_avg_epu8() rounds up, (a + b)>>1 is obtained removing the rounding bit
+                    __m128i b = rpng_sse2_load_pixel(prev + i, pixel_size);
+                    __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+                    a = _mm_add_epi8(rpng_sse2_load_pixel(filtered + i, pixel_size), avg);
+                    rpng_sse2_store_pixel(output + i, a, pixel_size);
+                }
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            if (pixel_simd)
+            {
+                uint8x8_t a = vdup_n_u8(0);
+                for (; i < size; i += pixel_size)
+                {
+                    a = vadd_u8(rpng_neon_load_pixel(filtered + i, pixel_size), vhadd_u8(a, rpng_neon_load_pixel(prev + i, pixel_size)));
+                    rpng_neon_store_pixel(output + i, a, pixel_size);
+                }
+            }
+        #endif
+            for (; i < pixel_size; i++) output[i] = (unsigned char)(filtered[i] + (prev[i]>>1));
+            for (; i < size; i++) output[i] = (unsigned char)(filtered[i] + ((output[i - pixel_size] + prev[i])>>1));
+        } break;
+        case 4:     // Filter type 4: Paeth
+        {
+        #if defined(RPNG_SIMD_SSE2)
+            if (pixel_simd)
+            {
+                __m128i zero = _mm_setzero_si128();
+                __m128i a = zero;
+                __m128i c = zero;
+                for (; i < size; i += pixel_size)
+                {
+                    __m128i b = _mm_unpacklo_epi8(rpng_sse2_load_pixel(prev + i, pixel_size), zero);
+                    __m128i pr = rpng_sse2_paeth_predictor(a, b, c);
+                    __m128i x = _mm_add_epi8(rpng_sse2_load_pixel(filtered + i, pixel_size), _mm_packus_epi16(pr, pr));
+                    rpng_sse2_store_pixel(output + i, x, pixel_size);
+                    a = _mm_unpacklo_epi8(x, zero);
+                    c = b;
+                }
+            }
+        #elif defined(RPNG_SIMD_NEON)
+            if (pixel_simd)
+            {
+                uint8x8_t a = vdup_n_u8(0);
+                uint8x8_t c = a;
+                for (; i < size; i += pixel_size)
+                {
+                    uint8x8_t b = rpng_neon_load_pixel(prev + i, pixel_size);
+                    a = vadd_u8(rpng_neon_load_pixel(filtered + i, pixel_size), rpng_neon_paeth_predictor(a, b, c));
+                    rpng_neon_store_pixel(output + i, a, pixel_size);
+                    c = b;
+                }
+            }
+        #endif
+            for (; i < pixel_size; i++) output[i] = (unsigned char)(filtered[i] + prev[i]);     // NOTE: a = c = 0, Paeth predictor is b
+            for (; i < size; i++) output[i] = (unsigned char)(filtered[i] + rpng_paeth_predictor(output[i - pixel_size], prev[i], prev[i - pixel_size]));
+        } break;
+        default: break;
+    }
+}
+
+// Swap integer from big<->little endian
+static unsigned int swap_endian(unsigned int value)
+{
+    // Swap endian (big to little) or (little to big)
+    unsigned int b0, b1, b2, b3;
+    unsigned int res;
+
+    b0 = (value & 0x000000ff) << 24u;
+    b1 = (value & 0x0000ff00) << 8u;
+    b2 = (value & 0x00ff0000) >> 8u;
     b3 = (value & 0xff000000) >> 24u;
 
     res = b0 | b1 | b2 | b3;
@@ -2219,47 +3806,239 @@ static unsigned int swap_endian(unsigned int value)
     return res;
 }
 
+// Read big endian unsigned int from buffer (no alignment required)
+static unsigned int read_uint32_be(const char *buffer)
+{
+    const unsigned char *bytes = (const unsigned char *)buffer;
+
+    return ((unsigned int)bytes[0] << 24) | ((unsigned int)bytes[1] << 16) | ((unsigned int)bytes[2] << 8) | (unsigned int)bytes[3];
+}
+
+// Write big endian unsigned int to buffer (no alignment required)
+static void write_uint32_be(char *buffer, unsigned int value)
+{
+    unsigned char *bytes = (unsigned char *)buffer;
+
+    bytes[0] = (unsigned char)(value >> 24);
+    bytes[1] = (unsigned char)(value >> 16);
+    bytes[2] = (unsigned char)(value >> 8);
+    bytes[3] = (unsigned char)value;
+}
+
+// Queue one edit operation, edit takes ownership of chunk data
+static void rpng_chunk_edit_push(rpng_chunk_edit *edit, int type, rpng_chunk chunk)
+{
+    if (edit == NULL)
+    {
+        RPNG_FREE(chunk.data);
+        return;
+    }
+
+    if (edit->op_count >= edit->op_capacity)
+    {
+        int op_capacity = (edit->op_capacity > 0)? edit->op_capacity*2 : 8;
+        rpng_chunk_edit_op *ops = (rpng_chunk_edit_op *)RPNG_REALLOC(edit->ops, op_capacity*sizeof(rpng_chunk_edit_op));
+
+        if (ops == NULL)
+        {
+            RPNG_LOG("WARNING: Chunk edit operation could not be queued, memory allocation failed\n");
+            RPNG_FREE(chunk.data);
+            return;
+        }
+
+        edit->ops = ops;
+        edit->op_capacity = op_capacity;
+    }
+
+    edit->ops[edit->op_count].type = type;
+    edit->ops[edit->op_count].chunk = chunk;
+    edit->op_count++;
+}
+
+// Check if chunk is kept by queued remove operations after op_index
+// NOTE: Source file chunks use op_index -1, so all queued remove operations are checked
+static bool rpng_chunk_edit_keep(const rpng_chunk_edit *edit, const char *chunk_type, int op_index, bool palette_found)
+{
+    bool keep = true;
+
+    for (int i = op_index + 1; (i < edit->op_count) && keep; i++)
+    {
+        if (edit->ops[i].type == RPNG_CHUNK_EDIT_REMOVE) keep = (memcmp(edit->ops[i].chunk.type, chunk_type, 4) != 0);
+        else if (edit->ops[i].type == RPNG_CHUNK_EDIT_REMOVE_ANCILLARY)
+        {
+            keep = ((memcmp(chunk_type, "IHDR", 4) == 0) ||
+                    (memcmp(chunk_type, "PLTE", 4) == 0) ||
+                    (memcmp(chunk_type, "IDAT", 4) == 0) ||
+                    (palette_found && (memcmp(chunk_type, "tRNS", 4) == 0)));
+        }
+    }
+
+    return keep;
+}
+
+#if defined(RPNG_CRC32_PCLMUL)
+// Check CPU support for PCLMULQDQ (CRC32 acceleration)
+// NOTE: No shared state written, safe to call from multiple threads: GCC/clang CPU features
+// are initialized once by the runtime, MSVC cpuid is queried on every call (large buffers only)
+static bool rpng_crc32_pclmul_supported(void)
+{
+    #if defined(_MSC_VER)
+        int info[4] = { 0 };
+        __cpuid(info, 1);
+        return ((info[2] & (1 << 1)) != 0);     // CPUID.1:ECX.PCLMULQDQ[bit 1]
+    #else
+        return __builtin_cpu_supports("pclmul");
+    #endif
+}
+#endif
+
+#if defined(RPNG_CRC32_PCLMUL)
+// Compute CRC32 using carry-less multiplication (PCLMULQDQ), folding 64 bytes per iteration
+// NOTE: Size must be a multiple of 16 and at least 64 bytes, crc is the running (not inverted) value
+// REF: Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+// REF: Chromium zlib, crc32_simd.c, bit-reflected constants for the CRC32 (PNG) polynomial
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("pclmul")))
+#endif
+static unsigned int rpng_crc32_pclmul(const unsigned char *buffer, int size, unsigned int crc)
+{
+    static const unsigned long long k1k2[2] = { 0x0154442bd4ULL, 0x01c6e41596ULL };
+    static const unsigned long long k3k4[2] = { 0x01751997d0ULL, 0x00ccaa009eULL };
+    static const unsigned long long k5k0[2] = { 0x0163cd6124ULL, 0x0000000000ULL };
+    static const unsigned long long poly[2] = { 0x01db710641ULL, 0x01f7011641ULL };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    // Load first 64 bytes block, including initial crc
+    x1 = _mm_loadu_si128((const __m128i *)(buffer + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buffer + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buffer + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buffer + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_loadu_si128((const __m128i *)k1k2);
+    buffer += 64;
+    size -= 64;
+
+    // Parallel fold blocks of 64 bytes
+    while (size >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(buffer + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(buffer + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(buffer + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(buffer + 0x30)));
+
+        buffer += 64;
+        size -= 64;
+    }
+
+    // Fold 4x128 bits into 128 bits
+    x0 = _mm_loadu_si128((const __m128i *)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Single fold blocks of 16 bytes
+    while (size >= 16)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)buffer)), x5);
+
+        buffer += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits into 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_loadu_si128((const __m128i *)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (unsigned int)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+#endif
+
+// Update running CRC32 value with buffer data (crc value not inverted)
+// NOTE: Uses ARMv8 CRC32 instructions when available at compile time, PCLMULQDQ if supported
+// by the CPU (runtime check) and slicing-by-8 tables (8 bytes per step) for the remaining data
+static unsigned int rpng_crc32_update(unsigned int crc, const unsigned char *buffer, int size)
+{
+#if defined(RPNG_CRC32_ARMV8)
+    for (; size >= 8; size -= 8, buffer += 8)
+    {
+        unsigned long long value = 0;
+        memcpy(&value, buffer, 8);
+        crc = __crc32d(crc, value);
+    }
+#elif defined(RPNG_CRC32_PCLMUL)
+    if ((size >= 64) && rpng_crc32_pclmul_supported())
+    {
+        int simd_size = size & ~15;
+        crc = rpng_crc32_pclmul(buffer, simd_size, crc);
+        buffer += simd_size;
+        size -= simd_size;
+    }
+#endif
+
+    // Slicing-by-8: process 8 bytes per step using 8 lookup tables
+    // NOTE: Bytes are combined explicitly, independent of platform endianness
+    for (; size >= 8; size -= 8, buffer += 8)
+    {
+        unsigned int one = crc ^ ((unsigned int)buffer[0] | ((unsigned int)buffer[1] << 8) | ((unsigned int)buffer[2] << 16) | ((unsigned int)buffer[3] << 24));
+        unsigned int two = (unsigned int)buffer[4] | ((unsigned int)buffer[5] << 8) | ((unsigned int)buffer[6] << 16) | ((unsigned int)buffer[7] << 24);
+
+        crc = crc_tables[7][one & 0xff] ^ crc_tables[6][(one >> 8) & 0xff] ^ crc_tables[5][(one >> 16) & 0xff] ^ crc_tables[4][one >> 24] ^
+              crc_tables[3][two & 0xff] ^ crc_tables[2][(two >> 8) & 0xff] ^ crc_tables[1][(two >> 16) & 0xff] ^ crc_tables[0][two >> 24];
+    }
+
+    for (; size > 0; size--, buffer++) crc = (crc >> 8) ^ crc_tables[0][(*buffer ^ crc) & 0xff];
+
+    return crc;
+}
+
 // Compute CRC32
 static unsigned int compute_crc32(unsigned char *buffer, int size)
 {
-    static unsigned int crc_table[256] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-        0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-    };
-
-    unsigned int crc = ~0u;
+    return ~rpng_crc32_update(~0u, buffer, size);
+}
 
-    for (int i = 0; i < size; i++) crc = (crc >> 8) ^ crc_table[buffer[i] ^ (crc & 0xff)];
+// Compute chunk CRC32 (computed over type + data), no need to join type and data
+static unsigned int compute_chunk_crc32(const char *type, const char *data, int length)
+{
+    unsigned int crc = rpng_crc32_update(~0u, (const unsigned char *)type, 4);
+    if ((data != NULL) && (length > 0)) crc = rpng_crc32_update(crc, (const unsigned char *)data, length);
 
     return ~crc;
 }
@@ -2311,6 +4090,86 @@ static char *load_file_to_buffer(const char *filename, int *bytes_read)
     return data;
 }
 
+// Load file data mapped into memory (read-only)
+// NOTE: File data is loaded into a memory buffer if memory mapping is not available,
+// data must be released with unload_file_mapped()
+static char *load_file_mapped(const char *filename, int *bytes_read, bool *mapped)
+{
+    char *data = NULL;
+    *bytes_read = 0;
+    *mapped = false;
+
+#if defined(RPNG_MMAP)
+    if (filename != NULL)
+    {
+        int fd = open(filename, O_RDONLY);
+
+        if (fd != -1)
+        {
+            struct stat file_info;
+
+            if ((fstat(fd, &file_info) == 0) && (file_info.st_size > 0) && (file_info.st_size <= 0x7fffffff))
+            {
+                void *file_map = mmap(NULL, (size_t)file_info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (file_map != MAP_FAILED)
+                {
+                    data = (char *)file_map;
+                    *bytes_read = (int)file_info.st_size;
+                    *mapped = true;
+
+                    RPNG_LOG("FILEIO: [%s] File mapped successfully\n", filename);
+                }
+            }
+
+            close(fd);
+        }
+    }
+#endif
+
+    if (data == NULL) data = load_file_to_buffer(filename, bytes_read);
+
+    return data;
+}
+
+// Unload file data, unmapped if it was memory mapped
+static void unload_file_mapped(char *data, int size, bool mapped)
+{
+#if defined(RPNG_MMAP)
+    if (mapped)
+    {
+        munmap(data, (size_t)size);
+        return;
+    }
+#endif
+    (void)size;
+    (void)mapped;
+
+    RPNG_FREE(data);
+}
+
+// Get PNG data size, up to IEND chunk end, returns 0 if not valid PNG data
+// NOTE: Used by memory functions not providing buffer size, PNG data is expected to end with IEND chunk
+static int get_png_size_from_memory(const char *buffer)
+{
+    int size = 0;
+
+    if ((buffer != NULL) && (memcmp(buffer, png_signature, 8) == 0))
+    {
+        long long offset = 8;
+
+        while (memcmp(buffer + offset + 4, "IEND", 4) != 0)
+        {
+            offset += (4 + 4 + (long long)read_uint32_be(buffer + offset) + 4);
+            if (offset > 0x7fffffff) return 0;
+        }
+
+        size = (int)(offset + 12);
+    }
+
+    return size;
+}
+
 // Write data to file from buffer
 static int save_file_from_buffer(const char *filename, void *data, int bytesToWrite)
 {
@@ -2318,51 +4177,208 @@ static int save_file_from_buffer(const char *filename, void *data, int bytesToWr
 #if !defined(RPNG_NO_STDIO)
     if ((filename != NULL) && (data != NULL) && (bytesToWrite > 0))
     {
-        FILE *file = fopen(filename, "wb");
+        FILE *file = fopen(filename, "wb");
+
+        if (file != NULL)
+        {
+            int count = (int)fwrite(data, sizeof(char), bytesToWrite, file);
+
+            if (count == 0) RPNG_LOG("FILEIO: [%s] Failed to write file\n", filename);
+            else if (count != bytesToWrite) RPNG_LOG("FILEIO: [%s] File partially written\n", filename);
+            else RPNG_LOG("FILEIO: [%s] File saved successfully\n", filename);
+
+            fclose(file);
+        }
+        else
+        {
+            result = RPNG_ERROR_FILE_OPEN;
+            RPNG_LOG("FILEIO: [%s] Failed to open file\n", filename);
+        }
+    }
+    else RPNG_LOG("FILEIO: File path or data provided are not valid\n");
+#else
+    (void)filename;
+    (void)data;
+    (void)bytesToWrite;
+    #ifndef RPNG_NO_STDIO_WARNING
+        #warning No FILE I/O API, RPNG_NO_STDIO defined
+    #endif
+#endif
+    return result;
+}
+
+// Check if the file exists
+static bool file_exists(const char *filename)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    if (_access(filename, 0) != -1) result = true;
+#else
+    if (access(filename, F_OK) != -1) result = true;
+#endif
+
+    return result;
+}
+
+#if !defined(RPNG_DEFLATE_IMPLEMENTATION) || defined(RPNG_NO_STDIO)
+// Streaming image saving not available
+// NOTE: Incremental compression requires sdefl implementation (RPNG_DEFLATE_IMPLEMENTATION) and FILE I/O
+rpng_save_stream *rpng_save_stream_begin(const char *filename, int width, int height, int color_channels, int bit_depth)
+{
+    return rpng_save_stream_begin_ex(filename, width, height, color_channels, bit_depth, RPNG_ENCODE_BALANCED);
+}
+
+rpng_save_stream *rpng_save_stream_begin_ex(const char *filename, int width, int height, int color_channels, int bit_depth, int encode_profile)
+{
+    (void)filename; (void)width; (void)height; (void)color_channels; (void)bit_depth; (void)encode_profile;
+    RPNG_LOG("WARNING: Streaming image saving not available, requires RPNG_DEFLATE_IMPLEMENTATION\n");
+    return NULL;
+}
+
+int rpng_save_stream_push_rows(rpng_save_stream *stream, const char *rows, int row_count)
+{
+    (void)stream; (void)rows; (void)row_count;
+    return RPNG_ERROR_FILE_OPEN;
+}
+
+int rpng_save_stream_end(rpng_save_stream *stream)
+{
+    (void)stream;
+    return RPNG_ERROR_FILE_OPEN;
+}
+#endif
+
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+
+//----------------------------------------------------------------------------------
+// Adler-32 checksum (zlib data integrity), shared by sdefl and sinfl
+//----------------------------------------------------------------------------------
+// Update Adler-32 checksum with data, SIMD accelerated (SSE2/NEON) if available
+// NOTE: Sums modulo is deferred every 5552 bytes, max data size before the 32bit s2 sum could overflow,
+// SIMD path processes 32 bytes per step, s2 weighted sums computed as columns sums by bytes position
+static unsigned int rpng_adler32(unsigned int adler, const unsigned char *data, int size)
+{
+    const unsigned int ADLER_MOD = 65521;
+    const int ADLER_BLOCK_SIZE = 5552;
+
+    unsigned int s1 = adler & 0xffff;
+    unsigned int s2 = adler >> 16;
+
+#if defined(RPNG_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i weights[4] = {
+        _mm_setr_epi16(32, 31, 30, 29, 28, 27, 26, 25), _mm_setr_epi16(24, 23, 22, 21, 20, 19, 18, 17),
+        _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9), _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1)
+    };
+
+    while (size >= 32)
+    {
+        int blocks = ((size < ADLER_BLOCK_SIZE)? size : ADLER_BLOCK_SIZE)/32;
+        size -= blocks*32;
+
+        __m128i prev_s1 = _mm_cvtsi32_si128((int)(s1*blocks)); // Sum of s1 at the beginning of every block
+        __m128i sum1 = zero;
+        __m128i sum2 = zero;
+
+        for (int i = 0; i < blocks; i++, data += 32)
+        {
+            __m128i bytes1 = _mm_loadu_si128((const __m128i *)data);
+            __m128i bytes2 = _mm_loadu_si128((const __m128i *)(data + 16));
+
+            prev_s1 = _mm_add_epi32(prev_s1, sum1);
+            sum1 = _mm_add_epi32(sum1, _mm_add_epi32(_mm_sad_epu8(bytes1, zero), _mm_sad_epu8(bytes2, zero)));
+
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi8(bytes1, zero), weights[0]));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpackhi_epi8(bytes1, zero), weights[1]));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi8(bytes2, zero), weights[2]));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpackhi_epi8(bytes2, zero), weights[3]));
+        }
+
+        sum2 = _mm_add_epi32(sum2, _mm_slli_epi32(prev_s1, 5));
+
+        // Horizontal sum of 32bit lanes
+        sum1 = _mm_add_epi32(sum1, _mm_shuffle_epi32(sum1, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum2 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum2 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        s1 += (unsigned int)_mm_cvtsi128_si32(sum1);
+        s2 += (unsigned int)_mm_cvtsi128_si32(sum2);
+
+        s1 %= ADLER_MOD;
+        s2 %= ADLER_MOD;
+    }
+#elif defined(RPNG_SIMD_NEON)
+    static const unsigned short weights[32] = {
+        32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+        16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+    };
+
+    while (size >= 32)
+    {
+        int blocks = ((size < ADLER_BLOCK_SIZE)? size : ADLER_BLOCK_SIZE)/32;
+        size -= blocks*32;
 
-        if (file != NULL)
+        uint32x4_t prev_s1 = vsetq_lane_u32(s1*blocks, vdupq_n_u32(0), 0); // Sum of s1 at the beginning of every block
+        uint32x4_t sum1 = vdupq_n_u32(0);
+        uint16x8_t column_sums[4] = { vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0) };
+
+        for (int i = 0; i < blocks; i++, data += 32)
         {
-            int count = (int)fwrite(data, sizeof(char), bytesToWrite, file);
+            uint8x16_t bytes1 = vld1q_u8(data);
+            uint8x16_t bytes2 = vld1q_u8(data + 16);
 
-            if (count == 0) RPNG_LOG("FILEIO: [%s] Failed to write file\n", filename);
-            else if (count != bytesToWrite) RPNG_LOG("FILEIO: [%s] File partially written\n", filename);
-            else RPNG_LOG("FILEIO: [%s] File saved successfully\n", filename);
+            prev_s1 = vaddq_u32(prev_s1, sum1);
+            sum1 = vpadalq_u16(sum1, vpadalq_u8(vpaddlq_u8(bytes1), bytes2));
 
-            fclose(file);
+            column_sums[0] = vaddw_u8(column_sums[0], vget_low_u8(bytes1));
+            column_sums[1] = vaddw_u8(column_sums[1], vget_high_u8(bytes1));
+            column_sums[2] = vaddw_u8(column_sums[2], vget_low_u8(bytes2));
+            column_sums[3] = vaddw_u8(column_sums[3], vget_high_u8(bytes2));
         }
-        else
+
+        uint32x4_t sum2 = vshlq_n_u32(prev_s1, 5);
+
+        for (int k = 0; k < 4; k++)
         {
-            result = RPNG_ERROR_FILE_OPEN;
-            RPNG_LOG("FILEIO: [%s] Failed to open file\n", filename);
+            sum2 = vmlal_u16(sum2, vget_low_u16(column_sums[k]), vld1_u16(weights + k*8));
+            sum2 = vmlal_u16(sum2, vget_high_u16(column_sums[k]), vld1_u16(weights + k*8 + 4));
         }
+
+        s1 += vgetq_lane_u32(sum1, 0) + vgetq_lane_u32(sum1, 1) + vgetq_lane_u32(sum1, 2) + vgetq_lane_u32(sum1, 3);
+        s2 += vgetq_lane_u32(sum2, 0) + vgetq_lane_u32(sum2, 1) + vgetq_lane_u32(sum2, 2) + vgetq_lane_u32(sum2, 3);
+
+        s1 %= ADLER_MOD;
+        s2 %= ADLER_MOD;
     }
-    else RPNG_LOG("FILEIO: File path or data provided are not valid\n");
-#else
-    (void)filename;
-    (void)data;
-    (void)bytesToWrite;
-    #ifndef RPNG_NO_STDIO_WARNING
-        #warning No FILE I/O API, RPNG_NO_STDIO defined
-    #endif
 #endif
-    return result;
-}
 
-// Check if the file exists
-static bool file_exists(const char *filename)
-{
-    bool result = false;
+    // Scalar processing for remaining data (or all data if SIMD not available)
+    while (size > 0)
+    {
+        int block_size = (size < ADLER_BLOCK_SIZE)? size : ADLER_BLOCK_SIZE;
+        size -= block_size;
 
-#if defined(_WIN32)
-    if (_access(filename, 0) != -1) result = true;
-#else
-    if (access(filename, F_OK) != -1) result = true;
-#endif
+        for (; block_size >= 8; block_size -= 8, data += 8)
+        {
+            s1 += data[0]; s2 += s1;
+            s1 += data[1]; s2 += s1;
+            s1 += data[2]; s2 += s1;
+            s1 += data[3]; s2 += s1;
+            s1 += data[4]; s2 += s1;
+            s1 += data[5]; s2 += s1;
+            s1 += data[6]; s2 += s1;
+            s1 += data[7]; s2 += s1;
+        }
 
-    return result;
-}
+        for (; block_size > 0; block_size--, data++) { s1 += *data; s2 += s1; }
 
-#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+        s1 %= ADLER_MOD;
+        s2 %= ADLER_MOD;
+    }
+
+    return (s2 << 16) | s1;
+}
 
 //=========================================================================
 //                              SDEFL
@@ -2671,9 +4687,10 @@ enum sdefl_blk_type {
   SDEFL_BLK_UCOMPR,
   SDEFL_BLK_DYN
 };
-static enum sdefl_blk_type
-sdefl_blk_type(const struct sdefl *s, int blk_len, int pre_item_len,
-               const unsigned *pre_freq, const unsigned char *pre_len) {
+static int
+sdefl_blk_cost(const struct sdefl *s, int blk_len, int pre_item_len,
+               const unsigned *pre_freq, const unsigned char *pre_len, int *fix_cost) {
+  /* block size in bits: dynamic huffman block returned, stored block in fix_cost */
   static const unsigned char x_pre_bits[] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,7};
   static const unsigned char x_len_bits[] = {0,0,0,0,0,0,0,0, 1,1,1,1,2,2,2,2,
     3,3,3,3,4,4,4,4, 5,5,5,5,0};
@@ -2681,7 +4698,6 @@ sdefl_blk_type(const struct sdefl *s, int blk_len, int pre_item_len,
     7,7,8,8,9,9,10,10, 11,11,12,12,13,13};
 
   int dyn_cost = 0;
-  int fix_cost = 0;
   int sym = 0;
 
   dyn_cost += 5 + 5 + 4 + (3 * pre_item_len);
@@ -2695,7 +4711,14 @@ sdefl_blk_type(const struct sdefl *s, int blk_len, int pre_item_len,
   for (sym = 0; sym < 30; sym++)
     dyn_cost += s->freq.off[sym] * (x_off_bits[sym] + s->cod.len.off[sym]);
 
-  fix_cost += 8*(5 * sdefl_div_round_up(blk_len, SDEFL_RAW_BLK_SIZE) + blk_len + 1 + 2);
+  *fix_cost = 8*(5 * sdefl_div_round_up(blk_len, SDEFL_RAW_BLK_SIZE) + blk_len + 1 + 2);
+  return dyn_cost;
+}
+static enum sdefl_blk_type
+sdefl_blk_type(const struct sdefl *s, int blk_len, int pre_item_len,
+               const unsigned *pre_freq, const unsigned char *pre_len) {
+  int fix_cost = 0;
+  int dyn_cost = sdefl_blk_cost(s, blk_len, pre_item_len, pre_freq, pre_len, &fix_cost);
   return (dyn_cost < fix_cost) ? SDEFL_BLK_DYN : SDEFL_BLK_UCOMPR;
 }
 static void
@@ -2720,6 +4743,25 @@ sdefl_match(unsigned char **dst, struct sdefl *s, int dist, int len) {
   sdefl_put(dst, s, (int)s->cod.word.off[cod.dc], s->cod.len.off[cod.dc]);
   sdefl_put(dst, s, dist - dmin[cod.dc], cod.dx);
 }
+static const unsigned char sdefl_pre_perm[SDEFL_PRE_MAX] = {16,17,18,0,8,7,9,6,
+    10,5,11,4,12,3,13,2,14,1,15};
+static int
+sdefl_blk_codes(struct sdefl *s, struct sdefl_symcnt *symcnt, unsigned *freqs,
+                unsigned *items, unsigned *codes, unsigned char *lens) {
+  /* calculate huffman codes, returns number of precode lengths */
+  int item_cnt = 0;
+  s->freq.lit[SDEFL_EOB]++;
+  sdefl_huff(s->cod.len.lit, s->cod.word.lit, s->freq.lit, SDEFL_SYM_MAX, SDEFL_LIT_LEN_CODES);
+  sdefl_huff(s->cod.len.off, s->cod.word.off, s->freq.off, SDEFL_OFF_MAX, SDEFL_OFF_CODES);
+  sdefl_precode(symcnt, freqs, items, s->cod.len.lit, s->cod.len.off);
+  sdefl_huff(lens, codes, freqs, SDEFL_PRE_MAX, SDEFL_PRE_CODES);
+  for (item_cnt = SDEFL_PRE_MAX; item_cnt > 4; item_cnt--) {
+    if (lens[sdefl_pre_perm[item_cnt - 1]]){
+      break;
+    }
+  }
+  return item_cnt;
+}
 static void
 sdefl_flush(unsigned char **dst, struct sdefl *s, int is_last,
             const unsigned char *in, int blk_begin, int blk_end) {
@@ -2730,20 +4772,9 @@ sdefl_flush(unsigned char **dst, struct sdefl *s, int is_last,
   unsigned char lens[SDEFL_PRE_MAX];
   unsigned freqs[SDEFL_PRE_MAX] = {0};
   unsigned items[SDEFL_SYM_MAX + SDEFL_OFF_MAX];
-  static const unsigned char perm[SDEFL_PRE_MAX] = {16,17,18,0,8,7,9,6,10,5,11,
-      4,12,3,13,2,14,1,15};
 
   /* calculate huffman codes */
-  s->freq.lit[SDEFL_EOB]++;
-  sdefl_huff(s->cod.len.lit, s->cod.word.lit, s->freq.lit, SDEFL_SYM_MAX, SDEFL_LIT_LEN_CODES);
-  sdefl_huff(s->cod.len.off, s->cod.word.off, s->freq.off, SDEFL_OFF_MAX, SDEFL_OFF_CODES);
-  sdefl_precode(&symcnt, freqs, items, s->cod.len.lit, s->cod.len.off);
-  sdefl_huff(lens, codes, freqs, SDEFL_PRE_MAX, SDEFL_PRE_CODES);
-  for (item_cnt = SDEFL_PRE_MAX; item_cnt > 4; item_cnt--) {
-    if (lens[perm[item_cnt - 1]]){
-      break;
-    }
-  }
+  item_cnt = sdefl_blk_codes(s, &symcnt, freqs, items, codes, lens);
   /* write block */
   switch (sdefl_blk_type(s, blk_len, item_cnt, freqs, lens)) {
   case SDEFL_BLK_UCOMPR: {
@@ -2773,7 +4804,7 @@ sdefl_flush(unsigned char **dst, struct sdefl *s, int is_last,
     sdefl_put(dst, s, symcnt.off - 1, 5);
     sdefl_put(dst, s, item_cnt - 4, 4);
     for (i = 0; i < item_cnt; ++i) {
-      sdefl_put(dst, s, lens[perm[i]], 3);
+      sdefl_put(dst, s, lens[sdefl_pre_perm[i]], 3);
     }
     for (i = 0; i < symcnt.items; ++i) {
       unsigned sym = items[i] & 0x1F;
@@ -2853,25 +4884,184 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s, int chain_len,
     i = s->prv[i & SDEFL_WIN_MSK];
   }
 }
+/* NOTE: rpng addition, block splitting (zopfli like): sequences of a parsed block
+ * are split in sub-blocks where the estimated compressed size decreases, every
+ * sub-block is written with its own huffman codes (or stored) */
+#define SDEFL_SPLIT_MAX     32  /* maximum number of sub-blocks per parsed block */
+#define SDEFL_SPLIT_MIN_SEQ 16  /* minimum number of sequences per sub-block */
+#define SDEFL_SPLIT_SAMPLES 9   /* split points evaluated per search step */
+static void
+sdefl_seq_freq(struct sdefl_freq *freq, int *blk_len, const struct sdefl *s,
+               const unsigned char *in, int from, int to) {
+  /* accumulate symbol frequencies and data length of sequences [from..to) */
+  int i, j;
+  for (i = from; i < to; ++i) {
+    if (s->seq[i].off >= 0) {
+      for (j = 0; j < s->seq[i].len; ++j) {
+        freq->lit[in[s->seq[i].off + j]]++;
+      }
+    } else {
+      struct sdefl_match_codest cod;
+      sdefl_match_codes(&cod, -s->seq[i].off, s->seq[i].len);
+      freq->lit[cod.lc]++;
+      freq->off[cod.dc]++;
+    }
+    *blk_len += s->seq[i].len;
+  }
+}
 static int
-sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+sdefl_seq_cost(struct sdefl *s, const struct sdefl_freq *freq, int blk_len) {
+  /* estimated size in bits of a block with provided symbol frequencies */
+  struct sdefl_symcnt symcnt = {0};
+  unsigned codes[SDEFL_PRE_MAX];
+  unsigned char lens[SDEFL_PRE_MAX];
+  unsigned freqs[SDEFL_PRE_MAX] = {0};
+  unsigned items[SDEFL_SYM_MAX + SDEFL_OFF_MAX];
+  int item_cnt, dyn_cost, fix_cost = 0;
+
+  s->freq = *freq;
+  item_cnt = sdefl_blk_codes(s, &symcnt, freqs, items, codes, lens);
+  dyn_cost = sdefl_blk_cost(s, blk_len, item_cnt, freqs, lens, &fix_cost);
+  return (dyn_cost < fix_cost) ? dyn_cost : fix_cost;
+}
+static int
+sdefl_split_fnd(struct sdefl *s, const unsigned char *in, int from, int to,
+                int *cost_lft, int *cost_rgt) {
+  /* find split point (sequence index) of [from..to) with smallest estimated size,
+   * split points are sampled and search is narrowed around best sample */
+  struct sdefl_freq all, lft, rgt;
+  int all_len = 0, best = -1, best_cost = INT_MAX;
+  int lo = from + SDEFL_SPLIT_MIN_SEQ, hi = to - SDEFL_SPLIT_MIN_SEQ;
+
+  memset(&all, 0, sizeof(all));
+  sdefl_seq_freq(&all, &all_len, s, in, from, to);
+  while (lo <= hi) {
+    int pts[SDEFL_SPLIT_SAMPLES];
+    int n = (hi - lo + 1 < SDEFL_SPLIT_SAMPLES) ? hi - lo + 1 : SDEFL_SPLIT_SAMPLES;
+    int k, m, pos = from, lft_len = 0, k_best = 0, k_cost = INT_MAX;
+
+    memset(&lft, 0, sizeof(lft));
+    for (k = 0; k < n; ++k) {
+      int c_lft, c_rgt;
+      pts[k] = (n < SDEFL_SPLIT_SAMPLES) ? lo + k : lo + ((hi - lo) * k) / (n - 1);
+      /* left frequencies are accumulated, right ones are the remaining */
+      sdefl_seq_freq(&lft, &lft_len, s, in, pos, pts[k]);
+      pos = pts[k];
+      for (m = 0; m < SDEFL_SYM_MAX; ++m) {
+        rgt.lit[m] = all.lit[m] - lft.lit[m];
+      }
+      for (m = 0; m < SDEFL_OFF_MAX; ++m) {
+        rgt.off[m] = all.off[m] - lft.off[m];
+      }
+      c_lft = sdefl_seq_cost(s, &lft, lft_len);
+      c_rgt = sdefl_seq_cost(s, &rgt, all_len - lft_len);
+      if (c_lft + c_rgt < k_cost) {
+        k_cost = c_lft + c_rgt, k_best = k;
+      }
+      if (c_lft + c_rgt < best_cost) {
+        best_cost = c_lft + c_rgt, best = pts[k];
+        *cost_lft = c_lft, *cost_rgt = c_rgt;
+      }
+    }
+    if (n < SDEFL_SPLIT_SAMPLES) break;
+    lo = (k_best > 0) ? pts[k_best - 1] + 1 : lo;
+    hi = (k_best < n - 1) ? pts[k_best + 1] - 1 : hi;
+  }
+  return best;
+}
+static void
+sdefl_flush_split(unsigned char **dst, struct sdefl *s, int is_last,
+                  const unsigned char *in, int blk_begin, int blk_end) {
+  int split[SDEFL_SPLIT_MAX + 1]; /* sub-blocks first sequence */
+  int cost[SDEFL_SPLIT_MAX];
+  unsigned char done[SDEFL_SPLIT_MAX];
+  int i, cnt = 1, seq_cnt = s->seq_cnt, moved = 0, begin = blk_begin;
+  int all_len = 0;
+
+  /* iteratively split biggest sub-block until no size gain */
+  split[0] = 0, split[1] = seq_cnt, done[0] = 0;
+  memset(&s->freq, 0, sizeof(s->freq));
+  sdefl_seq_freq(&s->freq, &all_len, s, in, 0, seq_cnt);
+  cost[0] = sdefl_seq_cost(s, &s->freq, all_len);
+  while (cnt < SDEFL_SPLIT_MAX) {
+    int b = -1, p, c_lft = 0, c_rgt = 0;
+    for (i = 0; i < cnt; ++i) {
+      if (!done[i] && (b < 0 || split[i+1] - split[i] > split[b+1] - split[b])) {
+        b = i;
+      }
+    }
+    if (b < 0) break;
+    p = sdefl_split_fnd(s, in, split[b], split[b+1], &c_lft, &c_rgt);
+    if (p < 0 || c_lft + c_rgt >= cost[b]) {
+      done[b] = 1;
+      continue;
+    }
+    memmove(&split[b+2], &split[b+1], (size_t)(cnt - b) * sizeof(split[0]));
+    memmove(&cost[b+2], &cost[b+1], (size_t)(cnt - b - 1) * sizeof(cost[0]));
+    memmove(&done[b+2], &done[b+1], (size_t)(cnt - b - 1) * sizeof(done[0]));
+    split[b+1] = p, cost[b] = c_lft, cost[b+1] = c_rgt;
+    done[b] = done[b+1] = 0;
+    cnt++;
+  }
+  /* write sub-blocks, sequences of every sub-block are moved to front */
+  for (i = 0; i < cnt; ++i) {
+    int len = 0;
+    if (split[i] > moved) {
+      memmove(s->seq, s->seq + (split[i] - moved), (size_t)(seq_cnt - split[i]) * sizeof(s->seq[0]));
+      moved = split[i];
+    }
+    memset(&s->freq, 0, sizeof(s->freq));
+    sdefl_seq_freq(&s->freq, &len, s, in, 0, split[i+1] - split[i]);
+    s->seq_cnt = split[i+1] - split[i];
+    sdefl_flush(dst, s, is_last && (i + 1 == cnt), in, begin, begin + len);
+    begin += len;
+  }
+  assert(begin == blk_end);
+  (void)blk_end;
+}
+/* compress in[in_begin..in_len), preceding data (up to window size) is used as
+ * preset dictionary, if not last the stream ends byte aligned: last byte is written
+ * as a stored block (instead of an empty stored block, rejected by some inflaters) */
+static int
+sdefl_compr_rng(struct sdefl *s, unsigned char *out, const unsigned char *in,
+                int in_begin, int in_len, int lvl, int is_last) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
-  int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
-  int n, i = 0, litlen = 0;
-  for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
+  int split = (lvl & SDEFL_BLK_SPLIT);
+  int rle = ((lvl & ~SDEFL_BLK_SPLIT) == SDEFL_LVL_RLE);
+  int max_chain = ((lvl & ~SDEFL_BLK_SPLIT) < 8) ? (1 << ((lvl & ~SDEFL_BLK_SPLIT) + 1)): (1 << 13);
+  int end = is_last ? in_len : in_len - 1;
+  int n, i = in_begin, litlen = 0;
+  int dict_end = (in_begin < in_len - 3) ? in_begin : in_len - 3;
+  lvl &= ~SDEFL_BLK_SPLIT;
+  if (rle) {
+    /* run-length matches only require previous byte, no hash table */
+    lvl = SDEFL_LVL_MIN;
+    dict_end = 0;
+  }
+  for (n = 0; n < SDEFL_HASH_SIZ && !rle; ++n) {
     s->tbl[n] = SDEFL_NIL;
   }
+  for (n = (in_begin > SDEFL_WIN_SIZ) ? in_begin - SDEFL_WIN_SIZ : 0; n < dict_end; ++n) {
+    unsigned h = sdefl_hash32(&in[n]);
+    s->prv[n&SDEFL_WIN_MSK] = s->tbl[h];
+    s->tbl[h] = n;
+  }
   do {int blk_begin = i;
-    int blk_end = ((i + SDEFL_BLK_MAX) < in_len) ? (i + SDEFL_BLK_MAX) : in_len;
+    int blk_end = ((i + SDEFL_BLK_MAX) < end) ? (i + SDEFL_BLK_MAX) : end;
     while (i < blk_end) {
       struct sdefl_match m = {0};
       int left = blk_end - i;
       int max_match = (left > SDEFL_MAX_MATCH) ? SDEFL_MAX_MATCH : left;
       int nice_match = pref[lvl] < max_match ? pref[lvl] : max_match;
       int run = 1, inc = 1, run_inc = 0;
-      if (max_match > SDEFL_MIN_MATCH) {
+      if (rle) {
+        if (i > 0 && max_match > SDEFL_MIN_MATCH) {
+          int len = 0;
+          while (len < max_match && in[i + len] == in[i - 1]) len++;
+          if (len >= SDEFL_MIN_MATCH) m.off = 1, m.len = len;
+        }
+      } else if (max_match > SDEFL_MIN_MATCH) {
         sdefl_fnd(&m, s, max_chain, max_match, in, i, in_len);
       }
       if (lvl >= 5 && m.len >= SDEFL_MIN_MATCH && m.len + 1 < nice_match){
@@ -2896,7 +5086,7 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
         litlen++;
       }
       run_inc = run * inc;
-      if (in_len - (i + run_inc) > SDEFL_MIN_MATCH) {
+      if (!rle && in_len - (i + run_inc) > SDEFL_MIN_MATCH) {
         while (run-- > 0) {
           unsigned h = sdefl_hash32(&in[i]);
           s->prv[i&SDEFL_WIN_MSK] = s->tbl[h];
@@ -2912,14 +5102,34 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in, blk_begin, blk_end);
-  } while (i < in_len);
+    if (split) {
+      sdefl_flush_split(&q, s, is_last && blk_end == end, in, blk_begin, blk_end);
+    } else {
+      sdefl_flush(&q, s, is_last && blk_end == end, in, blk_begin, blk_end);
+    }
+  } while (i < end);
+  if (!is_last) {
+    /* stored block with last byte */
+    sdefl_put(&q, s, 0x00, 1);
+    sdefl_put(&q, s, 0x00, 2);
+    if (s->bitcnt) {
+      sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+    }
+    sdefl_put16(&q, 0x0001);
+    sdefl_put16(&q, 0xFFFE);
+    *q++ = in[end];
+  }
   if (s->bitcnt) {
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   }
   assert(s->bitcnt == 0);
   return (int)(q - out);
 }
+static int
+sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
+            int in_len, int lvl) {
+  return sdefl_compr_rng(s, out, in, 0, in_len, lvl, 1);
+}
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
@@ -2928,33 +5138,8 @@ sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
   #define SDEFL_ADLER_INIT (1)
-  const unsigned ADLER_MOD = 65521;
-  unsigned s1 = adler32 & 0xffff;
-  unsigned s2 = adler32 >> 16;
-  unsigned blk_len, i;
-
-  blk_len = in_len % 5552;
-  while (in_len) {
-    for (i = 0; i + 7 < blk_len; i += 8) {
-      s1 += in[0]; s2 += s1;
-      s1 += in[1]; s2 += s1;
-      s1 += in[2]; s2 += s1;
-      s1 += in[3]; s2 += s1;
-      s1 += in[4]; s2 += s1;
-      s1 += in[5]; s2 += s1;
-      s1 += in[6]; s2 += s1;
-      s1 += in[7]; s2 += s1;
-      in += 8;
-    }
-    for (; i < blk_len; ++i) {
-      s1 += *in++, s2 += s1;
-    }
-    s1 %= ADLER_MOD;
-    s2 %= ADLER_MOD;
-    in_len -= blk_len;
-    blk_len = 5552;
-  }
-  return (unsigned)(s2 << 16) + (unsigned)s1;
+  /* NOTE: rpng SIMD accelerated implementation, shared with sinfl */
+  return rpng_adler32(adler32, in, in_len);
 }
 extern int
 zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
@@ -2977,12 +5162,388 @@ zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
 }
 extern int
 sdefl_bound(int len) {
-  int max_blocks = 1 + sdefl_div_round_up(len, SDEFL_RAW_BLK_SIZE);
+  /* every block (SDEFL_BLK_MAX) can be split in multiple raw blocks */
+  /* NOTE: rpng addition, every block can be split in SDEFL_SPLIT_MAX sub-blocks */
+  int max_blocks = 1 + sdefl_div_round_up(len, SDEFL_RAW_BLK_SIZE) + sdefl_div_round_up(len, SDEFL_BLK_MAX)*SDEFL_SPLIT_MAX;
   int bound = 5 * max_blocks + len + 1 + 4 + 8;
   return bound;
 }
 #endif /* SDEFL_IMPLEMENTATION */
 
+//----------------------------------------------------------------------------------
+// Parallel image data compression (requires sdefl implementation)
+//----------------------------------------------------------------------------------
+#if defined(RPNG_DEFLATE_PARALLEL)
+
+// Parallel compression job data
+typedef struct {
+    const unsigned char *data;      // Data to compress
+    int size;                       // Data size
+    int chunk_size;                 // Data size compressed by every job
+    int chunk_bound;                // Maximum compressed chunk size
+    int level;                      // Compression level
+    struct sdefl **states;          // Compressor state, one per thread
+    unsigned char *chunks;          // Compressed chunks data, chunk_bound bytes per chunk
+    int *chunks_size;               // Compressed chunks size
+    unsigned int *chunks_adler;     // Chunks data Adler-32 checksum
+} rpng_deflate_job;
+
+// Compress one data chunk, parallel job function
+// NOTE: Previous data (32KB) is used as dictionary, every chunk except the last
+// one ends byte aligned (not final block), so compressed chunks can be just concatenated
+static void rpng_deflate_chunk_job(void *data, int index, int thread)
+{
+    rpng_deflate_job *job = (rpng_deflate_job *)data;
+    int begin = index*job->chunk_size;
+    int end = (begin + job->chunk_size < job->size)? begin + job->chunk_size : job->size;
+    struct sdefl *s = job->states[thread];
+
+    s->bits = s->bitcnt = 0;
+    job->chunks_size[index] = sdefl_compr_rng(s, job->chunks + (size_t)job->chunk_bound*index, job->data, begin, end, job->level, (end == job->size));
+    job->chunks_adler[index] = sdefl_adler32(SDEFL_ADLER_INIT, job->data + begin, end - begin);
+}
+
+// Combine Adler-32 checksums of two consecutive data blocks, size2 is the second block size
+static unsigned int rpng_adler32_combine(unsigned int adler1, unsigned int adler2, int size2)
+{
+    const unsigned int ADLER_MOD = 65521;
+    unsigned int rem = (unsigned int)size2%ADLER_MOD;
+    unsigned int sum1 = adler1 & 0xffff;
+    unsigned int sum2 = (rem*sum1)%ADLER_MOD;
+
+    sum1 += (adler2 & 0xffff) + ADLER_MOD - 1;
+    sum2 += (adler1 >> 16) + (adler2 >> 16) + ADLER_MOD - rem;
+    if (sum1 >= ADLER_MOD) sum1 -= ADLER_MOD;
+    if (sum1 >= ADLER_MOD) sum1 -= ADLER_MOD;
+    if (sum2 >= (ADLER_MOD << 1)) sum2 -= (ADLER_MOD << 1);
+    if (sum2 >= ADLER_MOD) sum2 -= ADLER_MOD;
+
+    return (sum2 << 16) | sum1;
+}
+
+// Compress data into a zlib stream, data is split in chunks compressed in parallel
+// NOTE: Returns NULL in case of failure, zsdeflate() can be used as fallback
+static char *rpng_deflate_parallel(const unsigned char *data, int size, int level, int *output_size)
+{
+    char *output = NULL;
+
+    rpng_deflate_job job = { 0 };
+    job.data = data;
+    job.size = size;
+    job.chunk_size = RPNG_DEFLATE_CHUNK_SIZE;
+    job.chunk_bound = sdefl_bound(RPNG_DEFLATE_CHUNK_SIZE) + 6;   // Adding last byte stored block size
+    job.level = level;
+
+    int chunk_count = (size + job.chunk_size - 1)/job.chunk_size;
+    int thread_count = rpng_get_thread_count(chunk_count);
+
+    job.states = (struct sdefl **)RPNG_CALLOC(thread_count, sizeof(struct sdefl *));
+    job.chunks = (unsigned char *)RPNG_MALLOC((size_t)job.chunk_bound*chunk_count);
+    job.chunks_size = (int *)RPNG_CALLOC(chunk_count, sizeof(int));
+    job.chunks_adler = (unsigned int *)RPNG_CALLOC(chunk_count, sizeof(unsigned int));
+
+    bool ready = (job.states != NULL) && (job.chunks != NULL) && (job.chunks_size != NULL) && (job.chunks_adler != NULL);
+    for (int t = 0; ready && (t < thread_count); t++)
+    {
+        job.states[t] = (struct sdefl *)RPNG_CALLOC(1, sizeof(struct sdefl));
+        if (job.states[t] == NULL) ready = false;
+    }
+
+    if (ready)
+    {
+        rpng_parallel_for(rpng_deflate_chunk_job, &job, chunk_count, thread_count);
+
+        int compressed_size = 0;
+        for (int i = 0; i < chunk_count; i++) compressed_size += job.chunks_size[i];
+
+        output = (char *)RPNG_MALLOC(2 + compressed_size + 4);
+
+        if (output != NULL)
+        {
+            // Write zlib header: deflate, 32K window
+            output[0] = 0x78;
+            output[1] = 0x01;
+
+            // Join compressed chunks and combine chunks checksums
+            int offset = 2;
+            unsigned int adler = job.chunks_adler[0];
+
+            for (int i = 0; i < chunk_count; i++)
+            {
+                memcpy(output + offset, job.chunks + (size_t)job.chunk_bound*i, job.chunks_size[i]);
+                offset += job.chunks_size[i];
+
+                if (i > 0) adler = rpng_adler32_combine(adler, job.chunks_adler[i], ((i + 1)*job.chunk_size < size)? job.chunk_size : size - i*job.chunk_size);
+            }
+
+            // Write zlib Adler-32 checksum (big-endian)
+            output[offset] = (char)(adler >> 24);
+            output[offset + 1] = (char)(adler >> 16);
+            output[offset + 2] = (char)(adler >> 8);
+            output[offset + 3] = (char)adler;
+
+            *output_size = offset + 4;
+        }
+    }
+
+    if (job.states != NULL)
+    {
+        for (int t = 0; t < thread_count; t++) RPNG_FREE(job.states[t]);
+        RPNG_FREE(job.states);
+    }
+    RPNG_FREE(job.chunks);
+    RPNG_FREE(job.chunks_size);
+    RPNG_FREE(job.chunks_adler);
+
+    return output;
+}
+#endif  // RPNG_DEFLATE_PARALLEL
+
+//----------------------------------------------------------------------------------
+// Streaming image saving (requires sdefl implementation)
+//----------------------------------------------------------------------------------
+#if !defined(RPNG_NO_STDIO)
+
+// Streaming image saving state
+// NOTE: Filtered scanlines are accumulated in a window buffer, after the previous data kept as
+// compression dictionary (32KB), window data is compressed every RPNG_DEFLATE_CHUNK_SIZE bytes,
+// compressed chunks end byte aligned (not final block), so they can be written right away
+struct rpng_save_stream {
+    FILE *file;                             // Output file
+    int result;                             // Saving result, first error found
+    int height;                             // Image height (number of scanlines)
+    int pixel_size;                         // Pixel size in bytes
+    int scanline_size;                      // Scanline size in bytes
+    int scanline_count;                     // Number of scanlines already provided
+    int filter_type;                        // Scanlines filter type, -1 to choose best filter for every scanline, -2 for filter trials
+    int level;                              // Deflate compression level
+    unsigned char *prev_scanline;           // Previous source scanline, zeroed for the first image scanline
+    unsigned char *filter_scanlines;        // Filtered candidates scanlines (4 scanlines), only if best filter is chosen
+    unsigned char *trial_data;              // Filter candidates compressed data, only for filter trials
+    unsigned char *window;                  // Filtered data window: dictionary + data to compress
+    int window_size;                        // Filtered data window size (used)
+    int dict_size;                          // Window data already compressed, used as dictionary
+    unsigned int adler;                     // Filtered data Adler-32 checksum (zlib stream)
+    struct sdefl *sde;                      // Compressor state
+    unsigned char *comp_data;               // Compressed chunk data
+    unsigned char *idat_data;               // IDAT chunk data pending to be written
+    int idat_size;                          // IDAT chunk data size pending to be written
+};
+
+// Write one chunk to stream file (length + type + data + CRC32)
+static void rpng_save_stream_write_chunk(rpng_save_stream *stream, const char *type, const unsigned char *data, int length)
+{
+    char header[8] = { 0 };
+    char crc[4] = { 0 };
+
+    write_uint32_be(header, (unsigned int)length);
+    memcpy(header + 4, type, 4);
+    write_uint32_be(crc, compute_chunk_crc32(type, (const char *)data, length));
+
+    if ((fwrite(header, 1, 8, stream->file) != 8) ||
+        ((length > 0) && (fwrite(data, 1, length, stream->file) != (size_t)length)) ||
+        (fwrite(crc, 1, 4, stream->file) != 4))
+    {
+        if (stream->result == RPNG_SUCCESS) stream->result = RPNG_ERROR_FILE_WRITE;
+    }
+}
+
+// Append compressed data to IDAT chunks, full IDAT chunks are written to file
+static void rpng_save_stream_write_data(rpng_save_stream *stream, const unsigned char *data, int size)
+{
+    while (size > 0)
+    {
+        int copy_size = RPNG_STREAM_IDAT_SIZE - stream->idat_size;
+        if (copy_size > size) copy_size = size;
+
+        memcpy(stream->idat_data + stream->idat_size, data, copy_size);
+        stream->idat_size += copy_size;
+        data += copy_size;
+        size -= copy_size;
+
+        if (stream->idat_size == RPNG_STREAM_IDAT_SIZE)
+        {
+            rpng_save_stream_write_chunk(stream, "IDAT", stream->idat_data, stream->idat_size);
+            stream->idat_size = 0;
+        }
+    }
+}
+
+// Compress window data not compressed yet, is_last defines the final deflate block
+// NOTE: Last 32KB of window data are kept as dictionary for next data
+static void rpng_save_stream_compress(rpng_save_stream *stream, int is_last)
+{
+    int size = stream->window_size - stream->dict_size;
+
+    stream->sde->bits = stream->sde->bitcnt = 0;
+    int comp_size = sdefl_compr_rng(stream->sde, stream->comp_data, stream->window, stream->dict_size, stream->window_size, stream->level, is_last);
+    stream->adler = sdefl_adler32(stream->adler, stream->window + stream->dict_size, size);
+
+    rpng_save_stream_write_data(stream, stream->comp_data, comp_size);
+
+    // Keep last window data as dictionary
+    stream->dict_size = (stream->window_size < SDEFL_WIN_SIZ)? stream->window_size : SDEFL_WIN_SIZ;
+    memmove(stream->window, stream->window + stream->window_size - stream->dict_size, stream->dict_size);
+    stream->window_size = stream->dict_size;
+}
+
+// Begin streaming image saving, IHDR chunk is written to file
+// NOTE: Image data must be provided scanline by scanline with rpng_save_stream_push_rows()
+rpng_save_stream *rpng_save_stream_begin(const char *filename, int width, int height, int color_channels, int bit_depth)
+{
+    return rpng_save_stream_begin_ex(filename, width, height, color_channels, bit_depth, RPNG_ENCODE_BALANCED);
+}
+
+// Begin streaming image saving with requested encode profile (rpng_encode_profile)
+rpng_save_stream *rpng_save_stream_begin_ex(const char *filename, int width, int height, int color_channels, int bit_depth, int encode_profile)
+{
+    if ((bit_depth != 8) && (bit_depth != 16))
+    {
+        RPNG_LOG("WARNING: Requested bit depth (%i bit per channel) not supported\n", bit_depth);
+        return NULL;  // WARNING: Bit depth 1/2/4 not supported
+    }
+
+    int color_type = -1;
+    if (color_channels == 1) color_type = 0;        // Grayscale
+    else if (color_channels == 2) color_type = 4;   // Gray + Alpha
+    else if (color_channels == 3) color_type = 2;   // RGB
+    else if (color_channels == 4) color_type = 6;   // RGBA
+
+    if ((color_type == -1) || (width <= 0) || (height <= 0)) return NULL;   // WARNING: Image format not supported
+
+    rpng_save_stream *stream = (rpng_save_stream *)RPNG_CALLOC(1, sizeof(rpng_save_stream));
+    if (stream == NULL) return NULL;
+
+    stream->height = height;
+    stream->pixel_size = color_channels*(bit_depth/8);
+    stream->scanline_size = width*stream->pixel_size;
+    stream->adler = SDEFL_ADLER_INIT;
+    rpng_get_encode_settings(encode_profile, &stream->filter_type, &stream->level);
+
+    // NOTE: Window must fit dictionary + chunk to compress + one filtered scanline
+    int window_capacity = SDEFL_WIN_SIZ + RPNG_DEFLATE_CHUNK_SIZE + stream->scanline_size + 1;
+
+    stream->prev_scanline = (unsigned char *)RPNG_CALLOC(stream->scanline_size, 1);
+    if (stream->filter_type == -1) stream->filter_scanlines = (unsigned char *)RPNG_MALLOC(4*stream->scanline_size);
+    if (stream->filter_type == -2) stream->trial_data = (unsigned char *)RPNG_MALLOC(sdefl_bound(RPNG_FILTER_TRIAL_CONTEXT + stream->scanline_size + 1));
+    stream->window = (unsigned char *)RPNG_MALLOC(window_capacity);
+    stream->sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
+    stream->comp_data = (unsigned char *)RPNG_MALLOC(sdefl_bound(RPNG_DEFLATE_CHUNK_SIZE + stream->scanline_size + 1) + 6);
+    stream->idat_data = (unsigned char *)RPNG_MALLOC(RPNG_STREAM_IDAT_SIZE);
+    stream->file = fopen(filename, "wb");
+
+    if ((stream->prev_scanline == NULL) || ((stream->filter_type == -1) && (stream->filter_scanlines == NULL)) ||
+        ((stream->filter_type == -2) && (stream->trial_data == NULL)) || (stream->window == NULL) ||
+        (stream->sde == NULL) || (stream->comp_data == NULL) || (stream->idat_data == NULL) || (stream->file == NULL))
+    {
+        RPNG_LOG("WARNING: [%s] Streaming image saving could not be started\n", filename);
+        if (stream->file != NULL) fclose(stream->file);
+        stream->file = NULL;
+        rpng_save_stream_end(stream);
+        return NULL;
+    }
+
+    // Write PNG signature and IHDR chunk
+    unsigned char image_info[13] = { 0 };
+    write_uint32_be((char *)image_info, (unsigned int)width);
+    write_uint32_be((char *)image_info + 4, (unsigned int)height);
+    image_info[8] = (unsigned char)bit_depth;
+    image_info[9] = (unsigned char)color_type;
+
+    if (fwrite(png_signature, 1, 8, stream->file) != 8) stream->result = RPNG_ERROR_FILE_WRITE;
+    rpng_save_stream_write_chunk(stream, "IHDR", image_info, 13);
+
+    // Start zlib stream with header
+    unsigned char zlib_header[2] = { 0x78, 0x01 };
+    rpng_save_stream_write_data(stream, zlib_header, 2);
+
+    return stream;
+}
+
+// Push image scanlines to streaming image saving
+// NOTE: Scanlines are filtered and data is compressed once RPNG_DEFLATE_CHUNK_SIZE bytes are available
+int rpng_save_stream_push_rows(rpng_save_stream *stream, const char *rows, int row_count)
+{
+    if (stream == NULL) return RPNG_ERROR_FILE_OPEN;
+
+    if ((stream->scanline_count + row_count) > stream->height)
+    {
+        RPNG_LOG("WARNING: Streaming image saving, provided rows exceed image height\n");
+        row_count = stream->height - stream->scanline_count;
+        if (stream->result == RPNG_SUCCESS) stream->result = RPNG_ERROR_IMAGE_DATA;
+    }
+
+    for (int i = 0; i < row_count; i++)
+    {
+        const unsigned char *row = (const unsigned char *)rows + (size_t)stream->scanline_size*i;
+
+        if (stream->filter_type == -2)
+        {
+            // Previous window data is used as context, compressor state is shared (reset on every compression)
+            int context_size = (stream->window_size < RPNG_FILTER_TRIAL_CONTEXT)? stream->window_size : RPNG_FILTER_TRIAL_CONTEXT;
+
+            rpng_filter_row_trials(stream->window + stream->window_size, row, stream->prev_scanline, stream->scanline_size, stream->pixel_size, context_size, stream->sde, stream->trial_data);
+        }
+        else rpng_filter_row(stream->window + stream->window_size, row, stream->prev_scanline, stream->scanline_size, stream->pixel_size, stream->filter_type, stream->filter_scanlines);
+        memcpy(stream->prev_scanline, row, stream->scanline_size);
+
+        stream->window_size += (stream->scanline_size + 1);
+        stream->scanline_count++;
+
+        // Compress available data, last data is compressed on streaming end (final deflate block)
+        if (((stream->window_size - stream->dict_size) >= RPNG_DEFLATE_CHUNK_SIZE) && (stream->scanline_count < stream->height)) rpng_save_stream_compress(stream, 0);
+    }
+
+    return stream->result;
+}
+
+// End streaming image saving, remaining data is compressed and IEND chunk is written
+// NOTE: Stream is freed, returns saving process result: 0-SUCCESS
+int rpng_save_stream_end(rpng_save_stream *stream)
+{
+    if (stream == NULL) return RPNG_ERROR_FILE_OPEN;
+
+    int result = stream->result;
+
+    if (stream->file != NULL)
+    {
+        if (stream->scanline_count == stream->height)
+        {
+            rpng_save_stream_compress(stream, 1);
+
+            // Finish zlib stream with Adler-32 checksum
+            unsigned char adler[4] = { 0 };
+            write_uint32_be((char *)adler, stream->adler);
+            rpng_save_stream_write_data(stream, adler, 4);
+
+            if (stream->idat_size > 0) rpng_save_stream_write_chunk(stream, "IDAT", stream->idat_data, stream->idat_size);
+            rpng_save_stream_write_chunk(stream, "IEND", NULL, 0);
+
+            result = stream->result;
+        }
+        else
+        {
+            RPNG_LOG("WARNING: Streaming image saving, image data not complete (%i/%i scanlines)\n", stream->scanline_count, stream->height);
+            result = RPNG_ERROR_IMAGE_DATA;
+        }
+
+        if ((fclose(stream->file) != 0) && (result == RPNG_SUCCESS)) result = RPNG_ERROR_FILE_WRITE;
+    }
+
+    RPNG_FREE(stream->prev_scanline);
+    RPNG_FREE(stream->filter_scanlines);
+    RPNG_FREE(stream->trial_data);
+    RPNG_FREE(stream->window);
+    RPNG_FREE(stream->sde);
+    RPNG_FREE(stream->comp_data);
+    RPNG_FREE(stream->idat_data);
+    RPNG_FREE(stream);
+
+    return result;
+}
+#endif  // !RPNG_NO_STDIO
+
+
 
 //=========================================================================
 //                           SINFL
@@ -3061,7 +5622,14 @@ sinfl_copy128(unsigned char **dst, unsigned char **src) {
 #endif
 static void
 sinfl_refill(struct sinfl *s) {
-  s->bitbuf |= sinfl_read64(s->bitptr) << s->bitcnt;
+  if (sinfl_likely(s->bitend - s->bitptr >= 8)) {
+    s->bitbuf |= sinfl_read64(s->bitptr) << s->bitcnt;
+  } else {
+    /* NOTE: rpng bounds checked refill, no input data read after end (zeros) */
+    unsigned char tail[8] = {0};
+    if (s->bitptr < s->bitend) memcpy(tail, s->bitptr, (size_t)(s->bitend - s->bitptr));
+    s->bitbuf |= sinfl_read64(tail) << s->bitcnt;
+  }
   s->bitptr += (63 - s->bitcnt) >> 3;
   s->bitcnt |= 56; /* bitcount in range [56,63] */
 }
@@ -3235,6 +5803,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
   int last = 0;
 
   s.bitptr = in;
+  s.bitend = e;
   while (1) {
     switch (state) {
     case hdr: {
@@ -3244,6 +5813,8 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       last = sinfl__get(&s,1);
       type = sinfl__get(&s,2);
 
+      if (sinfl_unlikely(s.bitptr - e > 8))
+        return (int)(out-o);
       switch (type) {default: return (int)(out-o);
       case 0x00: state = stored; break;
       case 0x01: state = fixed; break;
@@ -3260,7 +5831,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 
       if ((unsigned short)len != (unsigned short)~nlen)
         return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
+      if (len > (e - s.bitptr) || len > (oe - out))
         return (int)(out-o);
 
       memcpy(out, s.bitptr, (size_t)len);
@@ -3301,10 +5872,14 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         int sym = 0;
         sinfl_refill(&s);
         sym = sinfl_decode(&s, hlens, 7);
-        switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        switch (sym) {default: lens[n++] = (unsigned char)sym; continue;
+        case 16: i = 3+sinfl_get(&s,2); break;
+        case 17: i = 3+sinfl_get(&s,3); break;
+        case 18: i = 11+sinfl_get(&s,7); break;}
+        /* repeat codes must not exceed code lengths count */
+        if ((sym == 16 && !n) || i > nlit+ndist-n)
+          return (int)(out-o);
+        for (;i;i--,n++) lens[n] = (sym == 16) ? lens[n-1] : 0;
       }
       /* build lit/dist tables */
       sinfl_build(s.lits, lens, 10, 15, nlit);
@@ -3325,6 +5900,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              return (int)(out-o);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -3348,6 +5926,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sinfl_unlikely(offs > (int)(out-o))) {
           return (int)(out-o);
         }
+        if (sinfl_unlikely(len > (int)(oe-out))) {
+          return (int)(out-o);
+        }
         out = out + len;
 
 #ifndef SINFL_NO_SIMD
@@ -3422,39 +6003,17 @@ sinflate(void *out, int cap, const void *in, int size) {
 }
 static unsigned
 sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
-  const unsigned ADLER_MOD = 65521;
-  unsigned s1 = adler32 & 0xffff;
-  unsigned s2 = adler32 >> 16;
-  unsigned blk_len, i;
-
-  blk_len = in_len % 5552;
-  while (in_len) {
-    for (i=0; i + 7 < blk_len; i += 8) {
-      s1 += in[0]; s2 += s1;
-      s1 += in[1]; s2 += s1;
-      s1 += in[2]; s2 += s1;
-      s1 += in[3]; s2 += s1;
-      s1 += in[4]; s2 += s1;
-      s1 += in[5]; s2 += s1;
-      s1 += in[6]; s2 += s1;
-      s1 += in[7]; s2 += s1;
-      in += 8;
-    }
-    for (; i < blk_len; ++i)
-      s1 += *in++, s2 += s1;
-    s1 %= ADLER_MOD; s2 %= ADLER_MOD;
-    in_len -= blk_len;
-    blk_len = 5552;
-  } return (unsigned)(s2 << 16) + (unsigned)s1;
+  /* NOTE: rpng SIMD accelerated implementation, shared with sdefl */
+  return rpng_adler32(adler32, in, in_len);
 }
 extern int
 zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
-    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
+    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size - 2);
     unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
-    unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
+    unsigned h = (unsigned)eob[0] << 24 | (unsigned)eob[1] << 16 | (unsigned)eob[2] << 8 | (unsigned)eob[3] << 0;
     return a == h ? n : -1;
   } else {
     return -1;
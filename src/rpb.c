@@ -126,7 +126,6 @@
 #include "styles/style_amber.h"             // raygui style: amber
 #include "styles/style_genesis.h"           // raygui style: genesis
 
-#define RINI_MAX_TEXT_SIZE        256       // WARNING: Text can contain paths and files-list, it should be probably bigger
 #define RINI_VALUE_SPACING         38
 #define RINI_IMPLEMENTATION
 #include "external/rini.h"                  // Config file values reader/writer
@@ -138,7 +137,7 @@
 // Standard C libraries
 #include <stdlib.h>                         // Required for: NULL, malloc(), free()
 #include <stdio.h>                          // Required for: fopen(), fclose(), fread()...
-#include <string.h>                         // Required for: strcmp(), strlen()
+#include <string.h>                         // Required for: strcmp(), strlen(), strstr()
 #include <math.h>                           // Required for: powf()
 #include <time.h>                           // Required for: time(), localtime()
 
@@ -211,6 +210,9 @@ static Rectangle panelView = { 0 };
 // Basic program variables
 //----------------------------------------------------------------------------------
 static rpcProjectConfigRaw project = { 0 };       // rpb project config data
+static char projectFileName[512] = { 0 };         // rpb project config file name (loaded/saved)
+static bool projectPathsValidationRequired = false; // rpb project file/path entries validation required
+static int projectInvalidPathCount = 0;           // rpb project file/path entries not valid
 
 static bool showMessageReset = false;       // Show message: reset
 static bool showMessageExit = false;        // Show message: exit (quit)
@@ -477,7 +479,11 @@ static void UpdateDrawFrame(void)
 
         if (IsFileExtension(droppedFiles.paths[0], ".rpc"))
         {
-            project = LoadProjectConfigRaw(droppedFiles.paths[0]);
+            UnloadProjectConfigRaw(project);
+            project = LoadProjectConfigRawResolved(droppedFiles.paths[0]);
+            strcpy(projectFileName, droppedFiles.paths[0]);
+            saveChangesRequired = false;
+            projectPathsValidationRequired = true;
 
             SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(droppedFiles.paths[0])));
         }
@@ -582,6 +588,18 @@ static void UpdateDrawFrame(void)
     //if (mainToolbarState.btnUserPressed) windowUserState.windowActive = true;
     //----------------------------------------------------------------------------------
 
+    // Project paths validation logic
+    // NOTE: Only required on project loading and entries edition, paths are validated in background
+    // and results polled every frame, a new validation is started once previous one finished
+    //----------------------------------------------------------------------------------
+    PollProjectConfigPathsValidation(project, &projectInvalidPathCount);
+
+    if (projectPathsValidationRequired)
+    {
+        if (ValidateProjectConfigPathsAsync(project, (projectFileName[0] != '\0')? GetDirectoryPath(projectFileName) : NULL)) projectPathsValidationRequired = false;
+    }
+    //----------------------------------------------------------------------------------
+
     // Basic program flow logic
     //----------------------------------------------------------------------------------
     framesCounter++;                    // General usage frames counter
@@ -694,22 +712,44 @@ static void UpdateDrawFrame(void)
                     {
                         bool checked = (bool)project.entries[i].value;
                         GuiCheckBox((Rectangle){ 24 + 2, 52 + 96 + 12 + 36 + (24 + 8)*k + 2 + panelScroll.y, 20, 20 }, project.entries[i].name + 5, &checked);
-                        project.entries[i].value = (checked? 1 : 0);
+                        if (project.entries[i].value != (checked? 1 : 0))
+                        {
+                            project.entries[i].value = (checked? 1 : 0);
+                            SetProjectConfigEntryChanged(&project.entries[i]);
+                        }
                     } break;
                     case RPC_TYPE_VALUE:
                     {
+                        int prevValue = project.entries[i].value;
                         if (GuiValueBox((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, 180, 24 },
                             NULL, &project.entries[i].value, 0, 1024, project.entries[i].editMode)) project.entries[i].editMode = !project.entries[i].editMode;
+                        if (project.entries[i].value != prevValue) SetProjectConfigEntryChanged(&project.entries[i]);
                     } break;
                     case RPC_TYPE_TEXT:
                     {
                         if (GuiTextBox((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, textWidth, 24 },
-                            project.entries[i].text, 255, project.entries[i].editMode)) project.entries[i].editMode = !project.entries[i].editMode;
+                            project.entries[i].text, 255, project.entries[i].editMode))
+                        {
+                            if (project.entries[i].editMode)    // Text edition finished
+                            {
+                                SetProjectConfigEntryChanged(&project.entries[i]);
+                                projectPathsValidationRequired = true;
+                            }
+                            project.entries[i].editMode = !project.entries[i].editMode;
+                        }
                     } break;
                     case RPC_TYPE_TEXT_FILE:
                     {
-                        if (GuiTextBox((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, textWidth - 90, 24 },
-                            project.entries[i].text, 255, project.entries[i].editMode)) project.entries[i].editMode = !project.entries[i].editMode;
+                        if (GuiTextBox((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, textWidth - 90 - 24, 24 },
+                            project.entries[i].text, 255, project.entries[i].editMode))
+                        {
+                            if (project.entries[i].editMode)    // Text edition finished
+                            {
+                                SetProjectConfigEntryChanged(&project.entries[i]);
+                                projectPathsValidationRequired = true;
+                            }
+                            project.entries[i].editMode = !project.entries[i].editMode;
+                        }
                         if (GuiButton((Rectangle){ 24 + 180 + textWidth - 86, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, 86, 24 }, "#6#Browse"))
                         {
                             memset(inFileName, 0, 256);
@@ -719,8 +759,16 @@ static void UpdateDrawFrame(void)
                     } break;
                     case RPC_TYPE_TEXT_PATH:
                     {
-                        if (GuiTextBox((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, textWidth - 90, 24 },
-                            project.entries[i].text, 255, project.entries[i].editMode)) project.entries[i].editMode = !project.entries[i].editMode;
+                        if (GuiTextBox((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, textWidth - 90 - 24, 24 },
+                            project.entries[i].text, 255, project.entries[i].editMode))
+                        {
+                            if (project.entries[i].editMode)    // Text edition finished
+                            {
+                                SetProjectConfigEntryChanged(&project.entries[i]);
+                                projectPathsValidationRequired = true;
+                            }
+                            project.entries[i].editMode = !project.entries[i].editMode;
+                        }
 #if defined(PLATFORM_WEB)
                         GuiDisable();
 #endif
@@ -735,15 +783,33 @@ static void UpdateDrawFrame(void)
                 }
                 GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
 
+                // Draw file/path validation status
+                if (project.entries[i].status != RPC_STATUS_NONE)
+                {
+                    GuiDrawIcon((project.entries[i].status == RPC_STATUS_VALID)? ICON_OK_TICK : ICON_CROSS,
+                        24 + 180 + textWidth - 90 - 20, 52 + 96 + 12 + 36 + (24 + 8)*k + 4 + panelScroll.y, 1,
+                        (project.entries[i].status == RPC_STATUS_VALID)? LIME : RED);
+                }
+
                 // Draw field description
+                // NOTE: Text referencing other entries or environment variables (${KEY}) shows resolved text,
+                // it is memoized, only resolved again when any referenced entry changes
+                const char *desc = project.entries[i].desc;
+                if (project.entries[i].status == RPC_STATUS_NOT_FOUND) desc = TextFormat("#220#Not found: %s", desc);
+                else if (project.entries[i].status == RPC_STATUS_INVALID) desc = TextFormat("#220#Not valid: %s", desc);
+                if ((project.entries[i].type >= RPC_TYPE_TEXT) && !project.entries[i].editMode && (strstr(project.entries[i].text, "${") != NULL))
+                    desc = TextFormat("= %s", GetProjectConfigEntryResolved(project, &project.entries[i]));
+
                 if (project.entries[i].type == RPC_TYPE_BOOL)
-                    GuiStatusBar((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, (textWidth + descWidth + 12), 24 }, project.entries[i].desc);
-                else GuiStatusBar((Rectangle){ 24 + 180 + textWidth + 12, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, descWidth, 24 }, project.entries[i].desc);
+                    GuiStatusBar((Rectangle){ 24 + 180, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, (textWidth + descWidth + 12), 24 }, desc);
+                else GuiStatusBar((Rectangle){ 24 + 180 + textWidth + 12, 52 + 96 + 12 + 36 + (24 + 8)*k + panelScroll.y, descWidth, 24 }, desc);
 
                 k++;
             }
         }
 
+        if (!saveChangesRequired && IsProjectConfigRawChanged(project)) saveChangesRequired = true;
+
         EndScissorMode();
         //----------------------------------------------------------------------------------
 
@@ -756,7 +822,7 @@ static void UpdateDrawFrame(void)
         //----------------------------------------------------------------------------------
         GuiStatusBar((Rectangle){ 0, GetScreenHeight() - 24, 320, 24 }, "NO FILE LOADED");
         GuiStatusBar((Rectangle){ 320 - 1, GetScreenHeight() - 24, 180, 24 }, "FILE INFO");
-        GuiStatusBar((Rectangle){ 320 + 180 - 2, GetScreenHeight() - 24, 340, 24 }, "MORE FILE INFO");
+        GuiStatusBar((Rectangle){ 320 + 180 - 2, GetScreenHeight() - 24, 340, 24 }, (projectInvalidPathCount > 0)? TextFormat("#220#%i paths not found or not valid", projectInvalidPathCount) : "MORE FILE INFO");
         GuiStatusBar((Rectangle){ 320 + 180 + 340 - 3, GetScreenHeight() - 24, GetScreenWidth() - 600, 24 }, NULL);
         //----------------------------------------------------------------------------------
 
@@ -875,6 +941,8 @@ static void UpdateDrawFrame(void)
                     // Update required property with selected path
                     memset(project.entries[projectEditProperty].text, 0, 256);
                     strcpy(project.entries[projectEditProperty].text, inFileName);
+                    SetProjectConfigEntryChanged(&project.entries[projectEditProperty]);
+                    projectPathsValidationRequired = true;
                 }
             }
 
@@ -896,6 +964,8 @@ static void UpdateDrawFrame(void)
                 // Update required property with selected path
                 memset(project.entries[projectEditProperty].text, 0, 256);
                 strcpy(project.entries[projectEditProperty].text, inFilePath);
+                SetProjectConfigEntryChanged(&project.entries[projectEditProperty]);
+                projectPathsValidationRequired = true;
             }
 
             if (result >= 0) showLoadDirectoryDialog = false;
@@ -913,7 +983,11 @@ static void UpdateDrawFrame(void)
 #endif
             if (result == 1)
             {
-                project = LoadProjectConfigRaw(inFileName);
+                UnloadProjectConfigRaw(project);
+                project = LoadProjectConfigRawResolved(inFileName);
+                strcpy(projectFileName, inFileName);
+                saveChangesRequired = false;
+                projectPathsValidationRequired = true;
 
                 SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
             }
@@ -936,7 +1010,11 @@ static void UpdateDrawFrame(void)
                 // Save file: outFileName
                 // Check for valid extension and make sure it is
                 if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rpc")) strcat(outFileName, ".rpc\0");
-                SaveProjectConfigRaw(project, outFileName, 0);
+
+                // NOTE: Saving over the loaded project file only patches changed entries
+                SaveProjectConfigRaw(project, outFileName, TextIsEqual(outFileName, projectFileName)? RPC_SAVE_INCREMENTAL : RPC_SAVE_FULL);
+                strcpy(projectFileName, outFileName);
+                saveChangesRequired = false;
 
             #if defined(PLATFORM_WEB)
                 // Download file from MEMFS (emscripten memory filesystem)
@@ -961,6 +1039,11 @@ static void UpdateDrawFrame(void)
 #endif
             if (result == 1)
             {
+                // Check misconfigured paths before building
+                // NOTE: Toolchain paths not found are detected after build started otherwise
+                projectInvalidPathCount = ValidateProjectConfigPaths(project, (projectFileName[0] != '\0')? GetDirectoryPath(projectFileName) : NULL);
+                if (projectInvalidPathCount > 0) TraceLog(LOG_WARNING, "RPB: Project contains %i paths not found or not valid, building could fail", projectInvalidPathCount);
+
                 // TODO: Build project to output directory defined
                 //int output = BuildProject(project);
 
@@ -1207,7 +1290,7 @@ static void LoadApplicationConfig(void)
 // Save application configuration
 static void SaveApplicationConfig(void)
 {
-    rini_data config = rini_load(NULL);   // Create empty config with 32 entries (RINI_MAX_CONFIG_CAPACITY)
+    rini_data config = rini_load(NULL);   // Create empty config, values array grows as required
 
     // Define header comment lines
     rini_set_comment_line(&config, NULL);   // Empty comment line, but including comment prefix delimiter
@@ -1232,6 +1315,7 @@ static void SaveApplicationConfig(void)
     char *configBase64 = EncodeDataBase64(configText, strlen(configText), &outputSize);
     SaveWebLocalStorage(TOOL_CONFIG_FILENAME, configBase64);
     MemFree(configBase64);
+    rini_unload_text(configText);
 #else
     rini_save(config, TextFormat("%s/%s", GetApplicationDirectory(), TOOL_CONFIG_FILENAME));
 #endif
@@ -1244,12 +1328,16 @@ static void SaveApplicationConfig(void)
 // emscripten interprets them as separate execution lines and fails -> Use Base64 string
 static void SaveWebLocalStorage(const char *key, const char *value)
 {
-    char script[2048] = { 0 };
-    snprintf(script, 2048, "localStorage.setItem(\"%s\", \"%s\")", key, value);
+    // NOTE: Script buffer allocated with required size, value size is not limited
+    int scriptSize = (int)(strlen(key) + strlen(value) + 32);
+    char *script = (char *)MemAlloc(scriptSize);
+    snprintf(script, scriptSize, "localStorage.setItem(\"%s\", \"%s\")", key, value);
 
     // Run script to save config to local storage
     // WARNING: TextFormat() can not be used because defaults to MAX 1024 chars
     emscripten_run_script(script);
+
+    MemFree(script);
 }
 
 // Load data from web LocalStorage (persistent between sessions)
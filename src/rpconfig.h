@@ -33,6 +33,30 @@
 
 #define RPC_MAX_PROPERTY_ENTRIES_RAW    128
 
+#define RPC_MAX_INHERIT_DEPTH           8       // Maximum base configs inheritance depth (base of base...)
+
+#define RPC_MAX_REFERENCE_DEPTH         8       // Maximum nested references depth on text interpolation (${KEY})
+#define RPC_MAX_REFERENCE_DEPS          16      // Maximum referenced entries tracked per entry, for memoized interpolation
+
+#define RPC_MAX_VALIDATION_THREADS      8       // Maximum threads used to validate file/path entries
+#define RPC_MAX_VALIDATION_CACHE        128     // Maximum validated paths cached, by path and modification time
+
+#define RPC_BINARY_CACHE_VERSION        2       // Binary project config cache (.rpcb) format version
+
+// Project config key defining base config file to inherit entries from (relative to project file)
+#define RPC_BASE_FILE_KEY               "PROJECT_BASE_FILE"
+
+// Support concurrent file/path entries validation on ValidateProjectConfigPaths()
+#if !defined(RPC_NO_THREADS) && !defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN__)
+    #define RPC_SUPPORT_THREADS
+#endif
+
+// Support binary project config cache (.rpcb) on LoadProjectConfigRaw()
+// NOTE: Cache file is generated next to the .rpc file and regenerated when .rpc changes
+#if !defined(RPC_NO_BINARY_CACHE)
+    #define RPC_SUPPORT_BINARY_CACHE
+#endif
+
 #define RPCAPI
 
 //----------------------------------------------------------------------------------
@@ -229,6 +253,20 @@ typedef enum {
     RPC_TYPE_TEXT_PATH,
 } rpcPropertyEntryType;
 
+// Property validation status (file/path entries)
+typedef enum {
+    RPC_STATUS_NONE = 0,        // Entry not validated or empty
+    RPC_STATUS_VALID,           // Entry file/directory found (and expected content)
+    RPC_STATUS_NOT_FOUND,       // Entry file/directory not found
+    RPC_STATUS_INVALID,         // Entry found but not valid: file vs directory, expected content missing
+} rpcPropertyEntryStatus;
+
+// Project config save flags
+typedef enum {
+    RPC_SAVE_FULL = 0,          // Save all entries, regenerating file organized by categories
+    RPC_SAVE_INCREMENTAL = 1,   // Save only changed entries, patching lines on existing file (comments and order are kept)
+} rpcSaveFlags;
+
 // Property platform type
 typedef enum {
     RPC_PLATFORM_WINDOWS = 0,
@@ -248,7 +286,8 @@ typedef enum {
 // every data entry is read from rpc config file
 typedef struct {
     char key[64];       // Entry key (as read from .rpc)
-    char text[256];     // Entry text data (selectedSource: TEXT, FILE, PATH) - WARNING: Max len defined for rini
+    char text[256];     // Entry text data (selectedSource: TEXT, FILE, PATH) - WARNING: Max len for UI edition
+    char *longText;     // Entry full text data, only if longer than text buffer (text keeps first 255 chars)
     char desc[128];     // Entry data description, useful for tooltips
 
     // Data extracted from key
@@ -260,14 +299,80 @@ typedef struct {
 
     // Transient data
     bool editMode;      // Edit mode required for UI text control
+    bool dirty;         // Entry changed since last load/save, required for incremental saving
+    bool inherited;     // Entry inherited from base config (resolved), only saved if changed
+    int status;         // Entry validation status (rpcPropertyEntryStatus), only FILE and PATH entries
+
+    // Interpolation data, resolved text is memoized until entry or referenced entries change
+    unsigned int revision;          // Entry revision, updated on every change
+    unsigned int resolvedRevision;  // Revision when resolved text was computed
+    unsigned int resolvedConfigId;  // Config id resolved text was computed for (base entries resolved per project)
+    bool resolvedValid;             // Resolved text memoized (references tracked)
+    int depCount;                   // Referenced entries count
+    int deps[RPC_MAX_REFERENCE_DEPS];   // Referenced entries: (base level << 16) | entry index
+    char *resolved;                 // Entry text with references replaced (full length, owned by entry)
 } rpcPropertyEntry;
 
 // Project Config Data (generic)
-typedef struct {
+typedef struct rpcProjectConfigRaw {
     int entryCount;     // Number of entries
     rpcPropertyEntry *entries;  // Entries
+    struct rpcProjectConfigRaw *base;   // Base config to inherit entries from (shared, not owned)
+    unsigned int id;    // Config data id, unique for every loaded config (0 if not loaded)
 } rpcProjectConfigRaw;
 
+// Project Config Workspace
+// NOTE: Workspace file (.rpw) lists multiple projects, base configs are loaded
+// only once and shared by all projects inheriting from them (copy-on-write)
+typedef struct {
+    int projectCount;           // Number of projects
+    rpcProjectConfigRaw *projects;  // Projects config data, only own entries (inherited entries shared from base)
+    char (*projectFileNames)[512];  // Projects file names
+
+    int baseCount;              // Number of base configs
+    rpcProjectConfigRaw *bases; // Base configs data, shared by projects
+    char (*baseFileNames)[512]; // Base configs file names
+} rpcProjectWorkspace;
+
+// Project Config Binary cache header (.rpcb)
+// NOTE: File layout: [header][entries table][strings pool]
+typedef struct {
+    unsigned char id[4];        // File identifier: "rPCB"
+    unsigned short version;     // File format version: RPC_BINARY_CACHE_VERSION
+    unsigned short entrySize;   // Entry size in bytes, sizeof(rpcBinaryEntry)
+    unsigned int sourceHash;    // Source .rpc file text hash (CRC32)
+    unsigned int sourceSize;    // Source .rpc file size in bytes
+    long long sourceModTime;    // Source .rpc file modification time
+    unsigned int entryCount;    // Number of entries in table
+    unsigned int poolSize;      // Strings pool size in bytes
+} rpcBinaryHeader;
+
+// Project Config Binary cache entry (.rpcb)
+// NOTE: Text offsets point to NULL-terminated strings in the strings pool
+typedef struct {
+    unsigned int keyOffset;     // Entry key offset in strings pool
+    unsigned int textOffset;    // Entry text offset in strings pool
+    unsigned int descOffset;    // Entry description offset in strings pool
+    unsigned int nameOffset;    // Entry name offset in strings pool
+    int category;               // Entry category
+    int platform;               // Entry platform
+    int type;                   // Entry type of data
+    int value;                  // Entry value
+} rpcBinaryEntry;
+
+// Project Config Binary cache data (read-only)
+// NOTE: File is memory-mapped when supported by platform, no parsing required,
+// entries and strings point directly to file data
+typedef struct {
+    const rpcBinaryHeader *header;  // Cache header
+    const rpcBinaryEntry *entries;  // Cache entries table
+    const char *strings;        // Cache strings pool
+
+    void *data;                 // Cache file data (mapped or loaded)
+    int dataSize;               // Cache file data size
+    bool mapped;                // Cache file data is memory-mapped
+} rpcProjectConfigBinary;
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -278,10 +383,27 @@ extern "C" {    // Prevents name mangling of functions
 
 RPCAPI rpcProjectConfigRaw LoadProjectConfigRaw(const char *fileName); // Load project config data from .rpc file
 RPCAPI void UnloadProjectConfigRaw(rpcProjectConfigRaw raw); // Unload project config raw data
-RPCAPI void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int flags); // Save project config raw data to .rpc file
-
-RPCAPI char *GetProjectConfigText(rpcProjectConfigRaw raw, const char *key); // Get project config text by key
-RPCAPI int *GetProjectConfigValue(rpcProjectConfigRaw raw, const char *key); // Get project config value by key
+RPCAPI void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int flags); // Save project config raw data to .rpc file (flags: rpcSaveFlags)
+RPCAPI bool IsProjectConfigRawChanged(rpcProjectConfigRaw raw); // Check if project config raw data has changed entries (not saved)
+RPCAPI int ValidateProjectConfigPaths(rpcProjectConfigRaw raw, const char *basePath); // Validate file/path entries (concurrently), returns not valid entries count
+RPCAPI bool ValidateProjectConfigPathsAsync(rpcProjectConfigRaw raw, const char *basePath); // Start file/path entries validation in background, false if a validation is still running
+RPCAPI bool PollProjectConfigPathsValidation(rpcProjectConfigRaw raw, int *invalidCount); // Check background validation, entries status updated once finished (returns true)
+
+RPCAPI rpcProjectConfigBinary LoadProjectConfigBinary(const char *fileName); // Load project config binary cache from .rpcb file (memory-mapped if supported)
+RPCAPI void UnloadProjectConfigBinary(rpcProjectConfigBinary bin); // Unload project config binary cache
+RPCAPI bool SaveProjectConfigBinary(rpcProjectConfigRaw raw, const char *fileName, const char *sourceFileName); // Save project config binary cache to .rpcb file, linked to source .rpc file
+
+RPCAPI rpcProjectConfigRaw LoadProjectConfigRawResolved(const char *fileName); // Load project config raw data, including entries inherited from base config(s)
+RPCAPI rpcProjectWorkspace LoadProjectWorkspace(const char *fileName); // Load projects workspace from .rpw file, base configs are shared
+RPCAPI void UnloadProjectWorkspace(rpcProjectWorkspace workspace); // Unload projects workspace
+
+RPCAPI char *GetProjectConfigText(rpcProjectConfigRaw raw, const char *key); // Get project config text by key (base config fallback)
+RPCAPI int *GetProjectConfigValue(rpcProjectConfigRaw raw, const char *key); // Get project config value by key (base config fallback)
+RPCAPI bool SetProjectConfigText(rpcProjectConfigRaw *raw, const char *key, const char *text); // Set project config text by key, inherited entries are copied on write
+RPCAPI bool SetProjectConfigValue(rpcProjectConfigRaw *raw, const char *key, int value); // Set project config value by key, inherited entries are copied on write
+RPCAPI const char *GetProjectConfigTextResolved(rpcProjectConfigRaw raw, const char *key); // Get project config text by key, references resolved: ${KEY} (memoized)
+RPCAPI const char *GetProjectConfigEntryResolved(rpcProjectConfigRaw raw, rpcPropertyEntry *entry); // Get project config entry text, references resolved: ${KEY} (memoized)
+RPCAPI void SetProjectConfigEntryChanged(rpcPropertyEntry *entry); // Set project config entry as changed, required after modifying entry data directly
 
 RPCAPI rpcProjectConfig *LoadProjectConfig(rpcProjectConfigRaw raw); // Load project config data from raw project config
 RPCAPI void UnloadProjectConfig(rpcProjectConfig *config);  // Unload project data
@@ -307,95 +429,341 @@ RPCAPI void SyncProjectConfigRaw(rpcProjectConfigRaw dst, rpcProjectConfig *src)
 #include "rini.h"
 
 #include <string.h>     // Required for: strncpy()
-#include <stdlib.h>     // Required for: calloc(), free()
+#include <stdlib.h>     // Required for: calloc(), free(), getenv()
+#include <stdio.h>      // Required for: fopen(), fwrite(), fclose(), rename(), remove(), snprintf()
+#include <limits.h>     // Required for: INT_MAX, INT_MIN
+
+// Atomic file saving support: flush to disk and replace
+#if defined(_WIN32)
+    #include <io.h>         // Required for: _open(), _commit(), _close()
+    #include <fcntl.h>      // Required for: _O_RDWR, _O_BINARY
+    #include <process.h>    // Required for: _getpid()
+
+    // NOTE: Avoiding <windows.h> inclusion, it conflicts with raylib
+    __declspec(dllimport) int __stdcall MoveFileExA(const char *lpExistingFileName, const char *lpNewFileName, unsigned long dwFlags);
+#else
+    #include <fcntl.h>      // Required for: open()
+    #include <unistd.h>     // Required for: fsync(), close(), getpid()
+#endif
+
+// File/path validation support: stat() and threads
+#include <sys/stat.h>       // Required for: stat(), fstat()
+#if defined(_WIN32)
+    #define RPC_STAT_STRUCT         struct _stat
+    #define RPC_STAT(path, st)      _stat(path, st)
+    #define RPC_STAT_IS_DIR(mode)   (((mode) & _S_IFMT) == _S_IFDIR)
+#else
+    #define RPC_STAT_STRUCT         struct stat
+    #define RPC_STAT(path, st)      stat(path, st)
+    #define RPC_STAT_IS_DIR(mode)   S_ISDIR(mode)
+#endif
+
+#if defined(RPC_SUPPORT_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>    // Required for: _beginthreadex()
+
+        // NOTE: Avoiding <windows.h> inclusion, it conflicts with raylib
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+    #endif
+#endif
+
+// Binary cache memory-mapping support
+// NOTE: Only POSIX mmap() supported, on other platforms cache file is just loaded into memory
+#if defined(RPC_SUPPORT_BINARY_CACHE) && !defined(_WIN32) && !defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN__)
+    #define RPC_BINARY_CACHE_MMAP
+    #include <sys/mman.h>   // Required for: mmap(), munmap()
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition (internal)
+//----------------------------------------------------------------------------------
+
+// Text interpolation state, required to resolve nested references
+typedef struct {
+    const rpcPropertyEntry *stack[RPC_MAX_REFERENCE_DEPTH]; // Entries being resolved, for cycles detection
+    int depth;                          // Entries being resolved count
+    int deps[RPC_MAX_REFERENCE_DEPS];   // Referenced entries, encoded as rpcPropertyEntry.deps
+    int depCount;                       // Referenced entries count, -1 if not trackable
+} rpcResolveState;
+
+// Key token kind, tokens are the key words separated by '_'
+typedef enum {
+    RPC_TOKEN_CATEGORY = 0,     // Category token, first key word
+    RPC_TOKEN_PLATFORM,         // Platform token, second key word (PLATFORM category)
+    RPC_TOKEN_FLAG,             // Flag token, any key word (value entries)
+    RPC_TOKEN_TYPE,             // Type token, last key word (text entries)
+} rpcKeyTokenKind;
+
+// Key token, keyword recognized on keys
+typedef struct {
+    const char *text;           // Token text
+    int length;                 // Token length
+    int kind;                   // Token kind (rpcKeyTokenKind)
+    int id;                     // Token id: category, platform or type
+} rpcKeyToken;
+
+// Path validation job, one per file/path entry
+typedef struct {
+    char path[512];             // Path to validate (resolved, relative to base path)
+    int type;                   // Entry type: RPC_TYPE_TEXT_FILE, RPC_TYPE_TEXT_PATH
+    const char *requiredFile;   // File expected inside directory (optional)
+    long long modTime;          // Path modification time
+    int status;                 // Validation status
+    bool cached;                // Validation status reused from cache
+} rpcPathValidationJob;
+
+// Path validation thread data
+typedef struct {
+    rpcPathValidationJob *jobs; // Jobs to process
+    int jobCount;               // Jobs count
+    int first;                  // First job index for thread
+    int stride;                 // Jobs index stride (threads count)
+    bool finished;              // Jobs processed (protected by lock on POSIX)
+#if defined(RPC_SUPPORT_THREADS) && !defined(_WIN32)
+    pthread_mutex_t *lock;      // Finished flag lock
+#endif
+} rpcPathValidationWork;
+
+// Path validation, jobs dispatched to validation threads
+typedef struct {
+    rpcPathValidationJob *jobs; // Jobs to process, one per file/path entry
+    int *jobEntries;            // Entry index for every job
+    int jobCount;               // Jobs count
+    unsigned int configId;      // Validated config data id, status only updated on same config
+    bool discarded;             // Validated config unloaded, results discarded
+    int threadCount;            // Jobs sets count, one per thread
+    rpcPathValidationWork work[RPC_MAX_VALIDATION_THREADS]; // Jobs sets
+#if defined(RPC_SUPPORT_THREADS)
+    bool threadCreated[RPC_MAX_VALIDATION_THREADS]; // Thread created for jobs set
+  #if defined(_WIN32)
+    uintptr_t threads[RPC_MAX_VALIDATION_THREADS];
+  #else
+    pthread_t threads[RPC_MAX_VALIDATION_THREADS];
+    pthread_mutex_t lock;       // Jobs sets finished flags lock
+  #endif
+#endif
+} rpcPathValidation;
+
+// Validated path cache entry
+typedef struct {
+    unsigned int hash;          // Path hash
+    char path[512];             // Path validated
+    long long modTime;          // Path modification time when validated
+    int status;                 // Validation status
+} rpcPathValidationCache;
+
+// Directories content expected for some known paths (toolchains, SDKs)
+// NOTE: Misconfigured toolchain paths are only detected on building otherwise
+static const struct {
+    const char *key;
+    const char *requiredFile;
+} pathRequirements[] = {
+    { "RAYLIB_SRC_PATH", "raylib.h" },
+    { "PLATFORM_WINDOWS_W64DEVKIT_PATH", "bin" },
+    { "PLATFORM_HTML5_EMSDK_PATH", "emsdk.py" },
+    { "PLATFORM_ANDROID_SDK_PATH", "platform-tools" },
+    { "PLATFORM_ANDROID_NDK_PATH", "source.properties" },
+    { "PLATFORM_ANDROID_JAVA_SDK_PATH", "bin" },
+};
+
+// Key tokens perfect hash table, indexed by RPC_KEY_TOKEN_HASH()
+// NOTE: Hash generated for the keywords set, no collisions, only one comparison required
+#define RPC_KEY_TOKEN_HASH(token, length) ((((unsigned int)(token)[0])*11 + ((unsigned int)(token)[(length) - 1])*7 + (unsigned int)(length)*6) & 31)
+
+static const rpcKeyToken keyTokens[32] = {
+    [0]  = { "PATH", 4, RPC_TOKEN_TYPE, RPC_TYPE_TEXT_PATH },
+    [5]  = { "FILES", 5, RPC_TOKEN_TYPE, RPC_TYPE_TEXT_FILE },
+    [6]  = { "PROJECT", 7, RPC_TOKEN_CATEGORY, RPC_CAT_PROJECT },
+    [8]  = { "FREEBSD", 7, RPC_TOKEN_PLATFORM, RPC_PLATFORM_FREEBSD },
+    [9]  = { "HTML5", 5, RPC_TOKEN_PLATFORM, RPC_PLATFORM_HTML5 },
+    [10] = { "LINUX", 5, RPC_TOKEN_PLATFORM, RPC_PLATFORM_LINUX },
+    [11] = { "FLAG", 4, RPC_TOKEN_FLAG, RPC_TYPE_BOOL },
+    [12] = { "WINDOWS", 7, RPC_TOKEN_PLATFORM, RPC_PLATFORM_WINDOWS },
+    [13] = { "SWITCH", 6, RPC_TOKEN_PLATFORM, RPC_PLATFORM_SWITCH },
+    [14] = { "DREAMCAST", 9, RPC_TOKEN_PLATFORM, RPC_PLATFORM_DREAMCAST },
+    [16] = { "BUILD", 5, RPC_TOKEN_CATEGORY, RPC_CAT_BUILD },
+    [17] = { "ANDROID", 7, RPC_TOKEN_PLATFORM, RPC_PLATFORM_ANDROID },
+    [18] = { "MACOS", 5, RPC_TOKEN_PLATFORM, RPC_PLATFORM_MACOS },
+    [24] = { "RAYLIB", 6, RPC_TOKEN_CATEGORY, RPC_CAT_RAYLIB },
+    [25] = { "DRM", 3, RPC_TOKEN_PLATFORM, RPC_PLATFORM_DRM },
+    [27] = { "PLATFORM", 8, RPC_TOKEN_CATEGORY, RPC_CAT_PLATFORM },
+    [28] = { "IMAGERY", 7, RPC_TOKEN_CATEGORY, RPC_CAT_IMAGERY },
+    [29] = { "FILE", 4, RPC_TOKEN_TYPE, RPC_TYPE_TEXT_FILE },
+    [31] = { "DEPLOY", 6, RPC_TOKEN_CATEGORY, RPC_CAT_DEPLOY },
+};
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static unsigned int entryRevisionCounter = 0;   // Entries revision counter, increased on every entry change
+static unsigned int layoutRevision = 0;         // Revision of last entries addition (copy-on-write), invalidates all resolved texts
+static unsigned int configIdCounter = 0;        // Config data id counter, increased on every config loaded
+
+static rpcPathValidationCache validationCache[RPC_MAX_VALIDATION_CACHE] = { 0 };   // Validated paths cache
+static int validationCacheCount = 0;            // Validated paths cache count
+static int validationCacheNext = 0;             // Validated paths cache next slot to replace (when full)
+static rpcPathValidation *backgroundValidation = NULL;  // Path validation running in background
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static rpcProjectConfigRaw LoadProjectConfigRawFromText(const char *text); // Load project config raw data from .rpc text
+static rpcProjectConfigRaw LoadProjectConfigRawFromBinary(rpcProjectConfigBinary bin); // Load project config raw data from binary cache
+static bool SaveProjectConfigBinaryEx(rpcProjectConfigRaw raw, const char *fileName, unsigned int sourceHash, unsigned int sourceSize, long long sourceModTime);
+static void UpdateProjectConfigBinaryCache(const char *fileName); // Regenerate binary cache (.rpcb) from saved .rpc file
+static bool SaveProjectConfigRawIncremental(rpcProjectConfigRaw raw, const char *fileName); // Save changed entries patching existing .rpc file lines
+static int PatchEntryLine(char *buffer, const char *line, int lineLength, const rpcPropertyEntry *entry); // Patch entry value on .rpc text line
+static int WriteEntryLine(char *buffer, const char *key, const rpcPropertyEntry *entry); // Write new entry line on .rpc text: key, value and description
+static int GetLineEntryKey(const char *line, int lineLength, rini_slice section, char *entryKey, int size); // Get entry key from .rpc text line (0 if not a key line)
+static int GetSectionEntryKey(rini_slice section, rini_slice key, char *entryKey, int size); // Get entry key from section and key: [PLATFORM.ANDROID] NDK_PATH -> PLATFORM_ANDROID_NDK_PATH
+static void CopyTextBounded(char *dst, const char *src, int size); // Copy text to fixed size buffer, truncated if required
+static const char *GetEntryText(const rpcPropertyEntry *entry); // Get entry full text, long text only if text not edited
+static void SetEntryLongText(rpcPropertyEntry *entry, const char *text, int length); // Set entry full text, kept only if longer than text buffer
+
+static bool SaveFileDataAtomic(const char *fileName, const void *data, int size);  // Save data to file atomically (temp file + replace)
+static bool ReplaceFileAtomic(const char *tempFileName, const char *fileName); // Flush temp file to disk and replace file
+
+static void UpdateEntryValue(rpcPropertyEntry *entry, int value); // Update property entry value and text
+static const rpcKeyToken *GetKeyToken(const char *token, int length); // Get key token from key word, NULL if not a keyword
+static void ClassifyEntryKey(rpcPropertyEntry *entry, bool isValue); // Classify entry key: category, platform, type and display name
+static const char *GetBaseFilePath(const char *fileName, const char *baseFileName); // Get base file path, relative to file directory
+static rpcPropertyEntry *FindProjectConfigEntry(rpcProjectConfigRaw raw, const char *key); // Find entry by key, own entries only
+static rpcPropertyEntry *GetProjectConfigEntryWrite(rpcProjectConfigRaw *raw, const char *key); // Get entry for writing, copying inherited entry (copy-on-write)
+static rpcProjectConfigRaw ResolveProjectConfigRaw(rpcProjectConfigRaw raw); // Flatten project config with base configs entries
+static rpcProjectConfigRaw *LoadWorkspaceBase(rpcProjectWorkspace *workspace, const char *fileName, int depth); // Load (or reuse) workspace base config
+
+static rpcPropertyEntry *FindProjectConfigEntryRef(rpcProjectConfigRaw raw, const char *key, int *ref); // Find entry by key (base config fallback), returning entry reference
+static bool IsEntryResolvedValid(rpcProjectConfigRaw raw, const rpcPropertyEntry *entry); // Check if entry memoized resolved text is still valid
+static const char *ResolveEntryTextMemo(rpcProjectConfigRaw raw, rpcPropertyEntry *entry, rpcResolveState *state); // Resolve entry text, memoized
+static char *ResolveEntryText(rpcProjectConfigRaw raw, const rpcPropertyEntry *entry, rpcResolveState *state); // Resolve entry text references into new allocated text
+
+static unsigned int ComputePathHash(const char *path); // Compute path hash (djb2)
+static void ValidatePathJob(rpcPathValidationJob *job); // Validate path job: stat path (and required file if not cached)
+static void ValidatePathJobs(rpcPathValidationWork *work); // Validate path jobs assigned to thread
+static rpcPathValidation *StartPathValidation(rpcProjectConfigRaw raw, const char *basePath, bool background); // Prepare path jobs and dispatch them to threads
+static bool IsPathValidationFinished(rpcPathValidation *validation); // Check if all path jobs have been processed (no wait)
+static int FinishPathValidation(rpcProjectConfigRaw raw, rpcPathValidation *validation); // Wait for path jobs, update entries status and validation cache
+#if defined(RPC_SUPPORT_THREADS)
+#if defined(_WIN32)
+static unsigned int __stdcall ValidatePathJobsThread(void *arg); // Validation thread entry point
+#else
+static void *ValidatePathJobsThread(void *arg); // Validation thread entry point
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
 
 // Load project config raw data from .rpc file
+// NOTE: If a valid binary cache (.rpcb) is available it is loaded instead, loading never writes files,
+// cache is only regenerated when saving with SaveProjectConfigRaw() (or SaveProjectConfigBinary())
 rpcProjectConfigRaw LoadProjectConfigRaw(const char *fileName)
 {
     rpcProjectConfigRaw raw = { 0 };
 
     if (FileExists(fileName))
     {
-        rini_data config = { 0 };
-        config = rini_load(fileName);
-
-        raw.entries = (rpcPropertyEntry *)RL_CALLOC(RPC_MAX_PROPERTY_ENTRIES_RAW, sizeof(rpcPropertyEntry));
-        raw.entryCount = RPC_MAX_PROPERTY_ENTRIES_RAW;
-
-        for (int i = 0; i < config.count; i++)
+#if defined(RPC_SUPPORT_BINARY_CACHE)
+        const char *cacheFileName = IsFileExtension(fileName, ".rpc")? TextFormat("%sb", fileName) : TextFormat("%s.rpcb", fileName);
+        unsigned int sourceSize = (unsigned int)GetFileLength(fileName);
+        long long sourceModTime = (long long)GetFileModTime(fileName);
+
+        // Check cache against source file size and modification time,
+        // source text is only loaded and hashed if they do not match
+        // NOTE: Source modified in the same second the cache was generated can not be
+        // detected by modification time, in that case source is always hashed
+        rpcProjectConfigBinary cache = LoadProjectConfigBinary(cacheFileName);
+        bool cacheValid = ((cache.header != NULL) &&
+            (cache.header->sourceSize == sourceSize) &&
+            (cache.header->sourceModTime == sourceModTime) &&
+            (sourceModTime < (long long)GetFileModTime(cacheFileName)));
+
+        if (cacheValid) raw = LoadProjectConfigRawFromBinary(cache);
+        else
         {
-            TextCopy(raw.entries[i].key, config.values[i].key);
-            TextCopy(raw.entries[i].desc, config.values[i].desc);
-            raw.entries[i].platform = RPC_PLATFORM_ANY;
+            char *text = LoadFileText(fileName);
 
-            // Category is parsed from first word on key
-            char category[32] = { 0 };
-            int categoryLen = 0; //TextFindIndex(config.values[i].key, "_");
-            for (int c = 0; c < 128; c++) { if (config.values[i].key[c] != '_') categoryLen++; else break; }
-            strncpy(category, config.values[i].key, categoryLen);
-            TextCopy(raw.entries[i].name, TextReplace(config.values[i].key + categoryLen + 1, "_", " "));
-
-            if (TextIsEqual(category, "PROJECT")) raw.entries[i].category = RPC_CAT_PROJECT;
-            else if (TextIsEqual(category, "BUILD")) raw.entries[i].category = RPC_CAT_BUILD;
-            else if (TextIsEqual(category, "PLATFORM"))
+            if (text != NULL)
             {
-                raw.entries[i].category = RPC_CAT_PLATFORM;
-
-                // Get platform from key
-                char platform[32] = { 0 };
-                int platformLen = 0;//TextFindIndex(config.values[i].key + categoryLen + 1, "_");
-                for (int c = 0; c < 128; c++) { if (config.values[i].key[c + categoryLen + 1] != '_') platformLen++; else break; }
-                memcpy(platform, config.values[i].key + categoryLen + 1, platformLen);
+                unsigned int sourceHash = ComputeCRC32((unsigned char *)text, (int)strlen(text));
 
-                if (TextIsEqual(platform, "WINDOWS")) raw.entries[i].platform = RPC_PLATFORM_WINDOWS;
-                else if (TextIsEqual(platform, "LINUX")) raw.entries[i].platform = RPC_PLATFORM_LINUX;
-                else if (TextIsEqual(platform, "MACOS")) raw.entries[i].platform = RPC_PLATFORM_MACOS;
-                else if (TextIsEqual(platform, "HTML5")) raw.entries[i].platform = RPC_PLATFORM_HTML5;
-                else if (TextIsEqual(platform, "ANDROID")) raw.entries[i].platform = RPC_PLATFORM_ANDROID;
-                else if (TextIsEqual(platform, "DRM")) raw.entries[i].platform = RPC_PLATFORM_DRM;
-                else if (TextIsEqual(platform, "SWITCH")) raw.entries[i].platform = RPC_PLATFORM_SWITCH;
-                else if (TextIsEqual(platform, "DREAMCAST")) raw.entries[i].platform = RPC_PLATFORM_DREAMCAST;
-                else if (TextIsEqual(platform, "FREEBSD")) raw.entries[i].platform = RPC_PLATFORM_FREEBSD;
+                // Source file touched but not changed, cache data is still valid
+                // NOTE: Outdated cache is not regenerated, source could be on a read-only location
+                if ((cache.header != NULL) && (cache.header->sourceHash == sourceHash)) raw = LoadProjectConfigRawFromBinary(cache);
+                else raw = LoadProjectConfigRawFromText(text);
 
-                memset(raw.entries[i].name, 0, 64);
-                TextCopy(raw.entries[i].name, config.values[i].key + categoryLen + platformLen + 2);
+                UnloadFileText(text);
             }
-            else if (TextIsEqual(category, "DEPLOY")) raw.entries[i].category = RPC_CAT_DEPLOY;
-            else if (TextIsEqual(category, "IMAGERY")) raw.entries[i].category = RPC_CAT_IMAGERY;
-            else if (TextIsEqual(category, "RAYLIB")) raw.entries[i].category = RPC_CAT_RAYLIB;
         }
 
-        for (int i = 0; i < config.count; i++)
+        UnloadProjectConfigBinary(cache);
+#else
+        char *text = LoadFileText(fileName);
+        raw = LoadProjectConfigRawFromText(text);
+        UnloadFileText(text);
+#endif
+    }
+
+    return raw;
+}
+
+// Load project config raw data from .rpc text
+// NOTE: Text is parsed in a single pass, entries data copied directly from text (no intermediate rini data)
+static rpcProjectConfigRaw LoadProjectConfigRawFromText(const char *text)
+{
+    rpcProjectConfigRaw raw = { 0 };
+
+    if (text != NULL)
+    {
+        rini_parser parser = rini_parser_init(text, (unsigned int)strlen(text));
+        rini_entry entry = { 0 };
+        int count = 0;
+
+        // NOTE: Keeping at least RPC_MAX_PROPERTY_ENTRIES_RAW entries, free slots are used for new entries
+        raw.entryCount = RPC_MAX_PROPERTY_ENTRIES_RAW;
+        raw.entries = (rpcPropertyEntry *)RL_CALLOC(raw.entryCount, sizeof(rpcPropertyEntry));
+        raw.id = ++configIdCounter;
+
+        while (rini_parse_next(&parser, &entry))
         {
-            // Type is parsed from key and value
-            if (!config.values[i].is_text)
+            if (count >= raw.entryCount)
             {
-                if (TextFindIndex(raw.entries[i].key, "_FLAG")) raw.entries[i].type = RPC_TYPE_BOOL;
-                else raw.entries[i].type = RPC_TYPE_VALUE;
+                raw.entries = (rpcPropertyEntry *)RL_REALLOC(raw.entries, raw.entryCount*2*sizeof(rpcPropertyEntry));
+                memset(raw.entries + raw.entryCount, 0, raw.entryCount*sizeof(rpcPropertyEntry));
+                raw.entryCount *= 2;
+            }
 
-                // Get the value
-                raw.entries[i].value = TextToInteger(config.values[i].text);
+            rpcPropertyEntry *rawEntry = &raw.entries[count];
+
+            // NOTE: Section entries keys are prefixed with section name: [PLATFORM.ANDROID] NDK_PATH -> PLATFORM_ANDROID_NDK_PATH
+            GetSectionEntryKey(entry.section, entry.key, rawEntry->key, sizeof(rawEntry->key));
+            rini_slice_copy(entry.desc, rawEntry->desc, sizeof(rawEntry->desc));
+
+            // Category, platform, type and name are parsed from key
+            ClassifyEntryKey(rawEntry, !entry.is_text);
+
+            // NOTE: Value already parsed by rini, same numeric semantics as rini_get_value() (float saturated to int range)
+            if (!entry.is_text)
+            {
+                if (entry.type != RINI_TYPE_FLOAT) rawEntry->value = entry.typed.int_value;
+                else if (entry.typed.float_value >= (float)INT_MAX) rawEntry->value = INT_MAX;
+                else if (entry.typed.float_value <= (float)INT_MIN) rawEntry->value = INT_MIN;
+                else rawEntry->value = (int)entry.typed.float_value;
             }
-            else // Value is text
+            else
             {
-                if (TextFindIndex(raw.entries[i].key, "_FILES") > 0)
-                {
-                    // TODO: How we check if files list includes multiple files,
-                    // checking for ';' separator???
-                    raw.entries[i].type = RPC_TYPE_TEXT_FILE;
-                }
-                else if (TextFindIndex(raw.entries[i].key, "_FILE")  > 0) raw.entries[i].type = RPC_TYPE_TEXT_FILE;
-                else if (TextFindIndex(raw.entries[i].key, "_PATH")  > 0) raw.entries[i].type = RPC_TYPE_TEXT_PATH;
-                else
-                {
-                    raw.entries[i].type = RPC_TYPE_TEXT;
-                }
-
-                TextCopy(raw.entries[i].text, config.values[i].text);
+                // NOTE: rini values have no size limit but entry text is a fixed buffer (UI edition),
+                // longer values are kept on long text, saved back as is if entry text not edited
+                rini_slice_copy(entry.text, rawEntry->text, sizeof(rawEntry->text));
+                SetEntryLongText(rawEntry, entry.text.ptr, (int)entry.text.len);
             }
-        }
 
-        rini_unload(&config);
+            count++;
+        }
     }
 
     return raw;
@@ -404,14 +772,147 @@ rpcProjectConfigRaw LoadProjectConfigRaw(const char *fileName)
 // Unload project data
 void UnloadProjectConfigRaw(rpcProjectConfigRaw raw)
 {
+    // Background validation results of unloaded config are never applied
+    if ((backgroundValidation != NULL) && (raw.id != 0) && (backgroundValidation->configId == raw.id)) backgroundValidation->discarded = true;
+
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        RL_FREE(raw.entries[i].longText);
+        RL_FREE(raw.entries[i].resolved);
+    }
+
     RL_FREE(raw.entries);
 }
 
+// Load project config binary cache from .rpcb file
+// NOTE: Data is validated but not parsed, entries point directly to file data
+rpcProjectConfigBinary LoadProjectConfigBinary(const char *fileName)
+{
+    rpcProjectConfigBinary bin = { 0 };
+
+    if ((fileName == NULL) || !FileExists(fileName)) return bin;
+
+#if defined(RPC_BINARY_CACHE_MMAP)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(fd, &info) == 0) && (info.st_size >= (off_t)sizeof(rpcBinaryHeader)))
+        {
+            void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data != MAP_FAILED)
+            {
+                bin.data = data;
+                bin.dataSize = (int)info.st_size;
+                bin.mapped = true;
+            }
+        }
+
+        close(fd);
+    }
+#else
+    bin.data = LoadFileData(fileName, &bin.dataSize);
+#endif
+
+    if (bin.data == NULL) return bin;
+
+    // Validate header and tables sizes, strings pool must be NULL-terminated
+    const rpcBinaryHeader *header = (const rpcBinaryHeader *)bin.data;
+    bool valid = false;
+
+    if ((bin.dataSize >= (int)sizeof(rpcBinaryHeader)) &&
+        (memcmp(header->id, "rPCB", 4) == 0) &&
+        (header->version == RPC_BINARY_CACHE_VERSION) &&
+        (header->entrySize == sizeof(rpcBinaryEntry)) &&
+        (header->poolSize > 0))
+    {
+        unsigned long long requiredSize = sizeof(rpcBinaryHeader) + (unsigned long long)header->entryCount*sizeof(rpcBinaryEntry) + header->poolSize;
+
+        if (requiredSize == (unsigned long long)bin.dataSize)
+        {
+            bin.header = header;
+            bin.entries = (const rpcBinaryEntry *)((const unsigned char *)bin.data + sizeof(rpcBinaryHeader));
+            bin.strings = (const char *)(bin.entries + header->entryCount);
+
+            valid = (bin.strings[header->poolSize - 1] == '\0');
+
+            for (unsigned int i = 0; valid && (i < header->entryCount); i++)
+            {
+                if ((bin.entries[i].keyOffset >= header->poolSize) ||
+                    (bin.entries[i].textOffset >= header->poolSize) ||
+                    (bin.entries[i].descOffset >= header->poolSize) ||
+                    (bin.entries[i].nameOffset >= header->poolSize)) valid = false;
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        UnloadProjectConfigBinary(bin);
+        bin = (rpcProjectConfigBinary){ 0 };
+    }
+
+    return bin;
+}
+
+// Unload project config binary cache
+void UnloadProjectConfigBinary(rpcProjectConfigBinary bin)
+{
+    if (bin.data == NULL) return;
+
+#if defined(RPC_BINARY_CACHE_MMAP)
+    if (bin.mapped) munmap(bin.data, (size_t)bin.dataSize);
+#else
+    UnloadFileData((unsigned char *)bin.data);
+#endif
+}
+
+// Save project config binary cache to .rpcb file, linked to source .rpc file
+// NOTE: Source file is hashed to detect changes on loading
+bool SaveProjectConfigBinary(rpcProjectConfigRaw raw, const char *fileName, const char *sourceFileName)
+{
+    bool success = false;
+    char *text = LoadFileText(sourceFileName);
+
+    if (text != NULL)
+    {
+        unsigned int sourceHash = ComputeCRC32((unsigned char *)text, (int)strlen(text));
+        success = SaveProjectConfigBinaryEx(raw, fileName, sourceHash, (unsigned int)GetFileLength(sourceFileName), (long long)GetFileModTime(sourceFileName));
+        UnloadFileText(text);
+    }
+
+    return success;
+}
+
 // Save project config data to .rpc file
 // NOTE: Same function as [rpc] tool but but adding more data
+// WARNING: RPC_SAVE_INCREMENTAL expects fileName to be the file data was loaded from,
+// full file is regenerated if it does not exist, on incremental saving failure file is not
+// modified (layout is kept) and entries remain changed
 void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int flags)
 {
-    rini_data config = rini_load(NULL);   // Create empty config with 32 entries (RINI_MAX_CONFIG_CAPACITY)
+    if ((flags & RPC_SAVE_INCREMENTAL) && FileExists(fileName))
+    {
+        if (SaveProjectConfigRawIncremental(raw, fileName))
+        {
+            for (int i = 0; i < raw.entryCount; i++)
+            {
+                // NOTE: Saved changes of inherited entries become project overrides
+                if (raw.entries[i].dirty) raw.entries[i].inherited = false;
+                raw.entries[i].dirty = false;
+            }
+
+            UpdateProjectConfigBinaryCache(fileName);
+        }
+        else TraceLog(LOG_WARNING, "RPC: [%s] Failed to save config changes incrementally", fileName);
+
+        return;
+    }
+
+    rini_data config = rini_load(NULL);   // Create empty config, values array grows as required
 
     // Define header comment lines
     rini_set_comment_line(&config, NULL);   // Empty comment line, but including comment prefix delimiter
@@ -448,13 +949,14 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     int platform;       // Entry platform-specific
     int type;           // Entry type of data: VALUE (int), BOOL (int), TEXT (string), FILE (string-file), PATH (string-path)
     int value;          // Entry value (type: VALUE, BOOL)
-    // TODO: WARNING: rini expects a maximum len for text of 256 chars, multiple files can be longer that that
+    // TODO: WARNING: UI edits a text buffer of 256 chars, multiple files can be longer that that (kept on longText until edited)
     char text[256];     // Entry text data (type: TEXT, FILE, PATH) - WARNING: It can include multiple paths
     char desc[128];     // Entry data description, useful for tooltips
     */
 
     // We are saving data into file organized by categories and platforms,
     // independently of the format it was originally loaded (in case of manual edition)
+    // NOTE: Entries inherited from base config are only saved if changed (overridden)
 
     // Saving PROJECT category data
     rini_set_comment_line(&config, "Project settings");
@@ -463,7 +965,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     {
         rpcPropertyEntry *entry = &raw.entries[i];
 
-        if (entry->category == RPC_CAT_PROJECT)
+        if ((entry->category == RPC_CAT_PROJECT) && (!entry->inherited || entry->dirty))
         {
             switch (entry->type)
             {
@@ -471,7 +973,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
                 case RPC_TYPE_VALUE: rini_set_value(&config, entry->key, entry->value, entry->desc); break;
                 case RPC_TYPE_TEXT:
                 case RPC_TYPE_TEXT_FILE:
-                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, entry->text, entry->desc); break;
+                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, GetEntryText(entry), entry->desc); break;
                 default: break;
             }
         }
@@ -484,7 +986,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     {
         rpcPropertyEntry *entry = &raw.entries[i];
 
-        if (entry->category == RPC_CAT_RAYLIB)
+        if ((entry->category == RPC_CAT_RAYLIB) && (!entry->inherited || entry->dirty))
         {
             switch (entry->type)
             {
@@ -492,7 +994,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
                 case RPC_TYPE_VALUE: rini_set_value(&config, entry->key, entry->value, entry->desc); break;
                 case RPC_TYPE_TEXT:
                 case RPC_TYPE_TEXT_FILE:
-                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, entry->text, entry->desc); break;
+                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, GetEntryText(entry), entry->desc); break;
                 default: break;
             }
         }
@@ -507,7 +1009,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     {
         rpcPropertyEntry *entry = &raw.entries[i];
 
-        if (entry->category == RPC_CAT_BUILD)
+        if ((entry->category == RPC_CAT_BUILD) && (!entry->inherited || entry->dirty))
         {
             switch (entry->type)
             {
@@ -515,7 +1017,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
                 case RPC_TYPE_VALUE: rini_set_value(&config, entry->key, entry->value, entry->desc); break;
                 case RPC_TYPE_TEXT:
                 case RPC_TYPE_TEXT_FILE:
-                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, entry->text, entry->desc); break;
+                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, GetEntryText(entry), entry->desc); break;
                 default: break;
             }
         }
@@ -529,7 +1031,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     {
         rpcPropertyEntry *entry = &raw.entries[i];
 
-        if (entry->category == RPC_CAT_PLATFORM)
+        if ((entry->category == RPC_CAT_PLATFORM) && (!entry->inherited || entry->dirty))
         {
             // Add line separator beetween platforms
             if ((entry->platform != RPC_PLATFORM_ANY) && 
@@ -545,7 +1047,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
                 case RPC_TYPE_VALUE: rini_set_value(&config, entry->key, entry->value, entry->desc); break;
                 case RPC_TYPE_TEXT:
                 case RPC_TYPE_TEXT_FILE:
-                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, entry->text, entry->desc); break;
+                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, GetEntryText(entry), entry->desc); break;
                 default: break;
             }
         }
@@ -559,7 +1061,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     {
         rpcPropertyEntry *entry = &raw.entries[i];
 
-        if (entry->category == RPC_CAT_DEPLOY)
+        if ((entry->category == RPC_CAT_DEPLOY) && (!entry->inherited || entry->dirty))
         {
             switch (entry->type)
             {
@@ -567,7 +1069,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
                 case RPC_TYPE_VALUE: rini_set_value(&config, entry->key, entry->value, entry->desc); break;
                 case RPC_TYPE_TEXT:
                 case RPC_TYPE_TEXT_FILE:
-                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, entry->text, entry->desc); break;
+                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, GetEntryText(entry), entry->desc); break;
                 default: break;
             }
         }
@@ -582,7 +1084,7 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
     {
         rpcPropertyEntry *entry = &raw.entries[i];
 
-        if (entry->category == RPC_CAT_IMAGERY)
+        if ((entry->category == RPC_CAT_IMAGERY) && (!entry->inherited || entry->dirty))
         {
             switch (entry->type)
             {
@@ -590,15 +1092,80 @@ void SaveProjectConfigRaw(rpcProjectConfigRaw raw, const char *fileName, int fla
                 case RPC_TYPE_VALUE: rini_set_value(&config, entry->key, entry->value, entry->desc); break;
                 case RPC_TYPE_TEXT:
                 case RPC_TYPE_TEXT_FILE:
-                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, entry->text, entry->desc); break;
+                case RPC_TYPE_TEXT_PATH: rini_set_value_text(&config, entry->key, GetEntryText(entry), entry->desc); break;
                 default: break;
             }
         }
     }
     rini_set_comment_line(&config, "------------------------------------------------------------------------------------\n");
 
-    rini_save(config, fileName);
+    // NOTE: rini saves to temp file first, replacing destination file only once fully written
+    int result = rini_save(config, fileName);
     rini_unload(&config);
+
+    if (result == 0)
+    {
+        for (int i = 0; i < raw.entryCount; i++)
+        {
+            if (raw.entries[i].dirty) raw.entries[i].inherited = false;
+            raw.entries[i].dirty = false;
+        }
+
+        UpdateProjectConfigBinaryCache(fileName);
+    }
+}
+
+// Check if project config raw data has changed entries (not saved)
+bool IsProjectConfigRawChanged(rpcProjectConfigRaw raw)
+{
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        if (raw.entries[i].dirty) return true;
+    }
+
+    return false;
+}
+
+// Validate file/path entries
+// NOTE: Paths are checked concurrently (one stat per path), relative paths are considered relative to basePath,
+// expected directory content of known toolchain paths is only checked again if path modification time changes
+// WARNING: Calling thread waits for all paths, use ValidateProjectConfigPathsAsync() on interactive loops,
+// a path on a slow or unavailable drive can take several seconds
+int ValidateProjectConfigPaths(rpcProjectConfigRaw raw, const char *basePath)
+{
+    rpcPathValidation *validation = StartPathValidation(raw, basePath, false);
+
+    return (validation != NULL)? FinishPathValidation(raw, validation) : 0;
+}
+
+// Start file/path entries validation in background
+// NOTE: Paths are validated by background threads, calling thread never waits for them,
+// results are applied to entries by PollProjectConfigPathsValidation(), only one validation runs at a time
+bool ValidateProjectConfigPathsAsync(rpcProjectConfigRaw raw, const char *basePath)
+{
+    if (backgroundValidation != NULL) return false;
+
+    backgroundValidation = StartPathValidation(raw, basePath, true);
+
+    return true;
+}
+
+// Check background file/path entries validation, returns true once finished
+// NOTE: Entries status is only updated on the same config validated (by config id, entries could have
+// been reallocated), results of an unloaded or reloaded config are discarded (returns false)
+bool PollProjectConfigPathsValidation(rpcProjectConfigRaw raw, int *invalidCount)
+{
+    if ((backgroundValidation == NULL) || !IsPathValidationFinished(backgroundValidation)) return false;
+
+    bool sameConfig = (!backgroundValidation->discarded && (backgroundValidation->configId != 0) && (backgroundValidation->configId == raw.id));
+    if (!sameConfig) backgroundValidation->jobCount = 0;    // Results discarded, not applied to entries
+
+    int count = FinishPathValidation(raw, backgroundValidation);
+    backgroundValidation = NULL;
+
+    if (sameConfig && (invalidCount != NULL)) *invalidCount = count;
+
+    return sameConfig;
 }
 
 // Load project config data data from .rpc file
@@ -638,66 +1205,68 @@ void SyncProjectConfig(rpcProjectConfig *dst, rpcProjectConfigRaw src)
 {
     for (int i = 0; i < src.entryCount; i++)
     {
+        const char *text = GetProjectConfigEntryResolved(src, &src.entries[i]);
+
         // PROJECT properties mapping
-        if (TextIsEqual(src.entries[i].key, "PROJECT_INTERNAL_NAME")) TextCopy(dst->Project.internalName, src.entries[i].text); // Project intenal name, used for executable and project files
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_REPO_NAME")) TextCopy(dst->Project.repoName, src.entries[i].text); // Project repository name, used for VCS (GitHub, GitLab)
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_COMMERCIAL_NAME")) TextCopy(dst->Project.commercialName, src.entries[i].text); // Project commercial name, used for docs and web
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_SHORT_NAME")) TextCopy(dst->Project.shortName, src.entries[i].text); // Project short name
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_VERSION")) TextCopy(dst->Project.version, src.entries[i].text); // Project version
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_DESCRIPTION")) TextCopy(dst->Project.description, src.entries[i].text); // Project description
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_PUBLISHER_NAME")) TextCopy(dst->Project.publisherName, src.entries[i].text); // Project publisher name
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_DEVELOPER_NAME")) TextCopy(dst->Project.developerName, src.entries[i].text); // Project developer name
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_DEVELOPER_URL")) TextCopy(dst->Project.developerUrl, src.entries[i].text); // Project developer webpage url
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_DEVELOPER_EMAIL")) TextCopy(dst->Project.developerEmail, src.entries[i].text); // Project developer email
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_ICON_FILE")) TextCopy(dst->Project.iconFile, src.entries[i].text); // Project icon file
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_SOURCE_PATH")) TextCopy(dst->Project.sourcePath, src.entries[i].text); // Project source directory, including all required code files (C/C++)
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_ASSETS_PATH")) TextCopy(dst->Project.assetsPath, src.entries[i].text); // Project assets directory, including all required assets
-        else if (TextIsEqual(src.entries[i].key, "PROJECT_ASSETS_OUTPUT_PATH")) TextCopy(dst->Project.assetsOutPath, src.entries[i].text); // Project assets destination path
+        if (TextIsEqual(src.entries[i].key, "PROJECT_INTERNAL_NAME")) CopyTextBounded(dst->Project.internalName, text, sizeof(dst->Project.internalName)); // Project intenal name, used for executable and project files
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_REPO_NAME")) CopyTextBounded(dst->Project.repoName, text, sizeof(dst->Project.repoName)); // Project repository name, used for VCS (GitHub, GitLab)
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_COMMERCIAL_NAME")) CopyTextBounded(dst->Project.commercialName, text, sizeof(dst->Project.commercialName)); // Project commercial name, used for docs and web
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_SHORT_NAME")) CopyTextBounded(dst->Project.shortName, text, sizeof(dst->Project.shortName)); // Project short name
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_VERSION")) CopyTextBounded(dst->Project.version, text, sizeof(dst->Project.version)); // Project version
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_DESCRIPTION")) CopyTextBounded(dst->Project.description, text, sizeof(dst->Project.description)); // Project description
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_PUBLISHER_NAME")) CopyTextBounded(dst->Project.publisherName, text, sizeof(dst->Project.publisherName)); // Project publisher name
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_DEVELOPER_NAME")) CopyTextBounded(dst->Project.developerName, text, sizeof(dst->Project.developerName)); // Project developer name
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_DEVELOPER_URL")) CopyTextBounded(dst->Project.developerUrl, text, sizeof(dst->Project.developerUrl)); // Project developer webpage url
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_DEVELOPER_EMAIL")) CopyTextBounded(dst->Project.developerEmail, text, sizeof(dst->Project.developerEmail)); // Project developer email
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_ICON_FILE")) CopyTextBounded(dst->Project.iconFile, text, sizeof(dst->Project.iconFile)); // Project icon file
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_SOURCE_PATH")) CopyTextBounded(dst->Project.sourcePath, text, sizeof(dst->Project.sourcePath)); // Project source directory, including all required code files (C/C++)
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_ASSETS_PATH")) CopyTextBounded(dst->Project.assetsPath, text, sizeof(dst->Project.assetsPath)); // Project assets directory, including all required assets
+        else if (TextIsEqual(src.entries[i].key, "PROJECT_ASSETS_OUTPUT_PATH")) CopyTextBounded(dst->Project.assetsOutPath, text, sizeof(dst->Project.assetsOutPath)); // Project assets destination path
         // raylib properties mapping
-        else if (TextIsEqual(src.entries[i].key, "RAYLIB_SRC_PATH")) TextCopy(dst->raylib.srcPath, src.entries[i].text); // Path to raylib source code, to be build for target platform
-        else if (TextIsEqual(src.entries[i].key, "RAYLIB_OPENGL_VERSION")) TextCopy(dst->raylib.glVersion, src.entries[i].text); // OpenGL version to be used by raylib, WARNING: Platform dependant!
+        else if (TextIsEqual(src.entries[i].key, "RAYLIB_SRC_PATH")) CopyTextBounded(dst->raylib.srcPath, text, sizeof(dst->raylib.srcPath)); // Path to raylib source code, to be build for target platform
+        else if (TextIsEqual(src.entries[i].key, "RAYLIB_OPENGL_VERSION")) CopyTextBounded(dst->raylib.glVersion, text, sizeof(dst->raylib.glVersion)); // OpenGL version to be used by raylib, WARNING: Platform dependant!
         // BUILD properties mapping
-        else if (TextIsEqual(src.entries[i].key, "BUILD_OUTPUT_PATH")) TextCopy(dst->Build.outputPath, src.entries[i].text); // Build output path
-        else if (TextIsEqual(src.entries[i].key, "BUILD_TARGET_PLATFORM")) TextCopy(dst->Build.targetPlatform, src.entries[i].text); // Build target platform (Supported: Windows, Linux, macOS, Android, Web)
-        else if (TextIsEqual(src.entries[i].key, "BUILD_TARGET_ARCHITECTURE")) TextCopy(dst->Build.targetArchitecture, src.entries[i].text); // Build target architecture (Supported: x86-64, Win32, arm64)
-        else if (TextIsEqual(src.entries[i].key, "BUILD_TARGET_MODE")) TextCopy(dst->Build.targetMode, src.entries[i].text); // Build target mode (Supported: DEBUG, RELEASE, DEBUG_DLL, RELEASE_DLL)
+        else if (TextIsEqual(src.entries[i].key, "BUILD_OUTPUT_PATH")) CopyTextBounded(dst->Build.outputPath, text, sizeof(dst->Build.outputPath)); // Build output path
+        else if (TextIsEqual(src.entries[i].key, "BUILD_TARGET_PLATFORM")) CopyTextBounded(dst->Build.targetPlatform, text, sizeof(dst->Build.targetPlatform)); // Build target platform (Supported: Windows, Linux, macOS, Android, Web)
+        else if (TextIsEqual(src.entries[i].key, "BUILD_TARGET_ARCHITECTURE")) CopyTextBounded(dst->Build.targetArchitecture, text, sizeof(dst->Build.targetArchitecture)); // Build target architecture (Supported: x86-64, Win32, arm64)
+        else if (TextIsEqual(src.entries[i].key, "BUILD_TARGET_MODE")) CopyTextBounded(dst->Build.targetMode, text, sizeof(dst->Build.targetMode)); // Build target mode (Supported: DEBUG, RELEASE, DEBUG_DLL, RELEASE_DLL)
         else if (TextIsEqual(src.entries[i].key, "BUILD_FLAG_ASSETS_VALIDATION")) dst->Build.assetsValidation = src.entries[i].value; // Flag: request assets validation on building
         else if (TextIsEqual(src.entries[i].key, "BUILD_FLAG_ASSETS_PACKAGING")) dst->Build.assetsPackaging = src.entries[i].value; // Flag: request assets packaging on building
         // PLATFORM properties mapping
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_MSBUILD_PATH")) TextCopy(dst->Platform.Windows.msbuildPath, src.entries[i].text); // Path to MSBuild system, required to build VS2022 solution
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_W64DEVKIT_PATH")) TextCopy(dst->Platform.Windows.w64devkitPath, src.entries[i].text); // Path to w64devkit (GCC), required to use Makefile building
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_SIGNTOOL_PATH")) TextCopy(dst->Platform.Windows.signtoolPath, src.entries[i].text); // Path to signtool in case program needs to be signed (certificate required)
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_SIGNCERT_FILE")) TextCopy(dst->Platform.Windows.signCertFile, src.entries[i].text); // Path to a valid signature certificate to sign executable
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_MSBUILD_PATH")) CopyTextBounded(dst->Platform.Windows.msbuildPath, text, sizeof(dst->Platform.Windows.msbuildPath)); // Path to MSBuild system, required to build VS2022 solution
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_W64DEVKIT_PATH")) CopyTextBounded(dst->Platform.Windows.w64devkitPath, text, sizeof(dst->Platform.Windows.w64devkitPath)); // Path to w64devkit (GCC), required to use Makefile building
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_SIGNTOOL_PATH")) CopyTextBounded(dst->Platform.Windows.signtoolPath, text, sizeof(dst->Platform.Windows.signtoolPath)); // Path to signtool in case program needs to be signed (certificate required)
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_WINDOWS_SIGNCERT_FILE")) CopyTextBounded(dst->Platform.Windows.signCertFile, text, sizeof(dst->Platform.Windows.signCertFile)); // Path to a valid signature certificate to sign executable
         else if (TextIsEqual(src.entries[i].key, "PLATFORM_LINUX_FLAG_CROSS_COMPILE")) dst->Platform.Linux.useCrossCompiler = src.entries[i].value; // Flag: request cross-compiler usage
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_LINUX_CROSS_COMPILER_PATH")) TextCopy(dst->Platform.Linux.crossCompilerPath, src.entries[i].text); // Path to GCC compiler (probably not required)
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_MACOS_BUNDLE_INFO_FILE")) TextCopy(dst->Platform.macOS.bundleInfoFile, src.entries[i].text); // Path to macOS bundle options (Info.plist)
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_MACOS_BUNDLE_NAME")) TextCopy(dst->Platform.macOS.bundleName, src.entries[i].text); // Bundle name
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_MACOS_BUNDLE_VERSION")) TextCopy(dst->Platform.macOS.bundleVersion, src.entries[i].text); // Bundle version
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_EMSDK_PATH")) TextCopy(dst->Platform.HTML5.emsdkPath, src.entries[i].text); // Path to emsdk, required for Web building
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_SHELL_FILE")) TextCopy(dst->Platform.HTML5.shellFile, src.entries[i].text); // Path to shell file to be used by emscripten
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_LINUX_CROSS_COMPILER_PATH")) CopyTextBounded(dst->Platform.Linux.crossCompilerPath, text, sizeof(dst->Platform.Linux.crossCompilerPath)); // Path to GCC compiler (probably not required)
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_MACOS_BUNDLE_INFO_FILE")) CopyTextBounded(dst->Platform.macOS.bundleInfoFile, text, sizeof(dst->Platform.macOS.bundleInfoFile)); // Path to macOS bundle options (Info.plist)
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_MACOS_BUNDLE_NAME")) CopyTextBounded(dst->Platform.macOS.bundleName, text, sizeof(dst->Platform.macOS.bundleName)); // Bundle name
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_MACOS_BUNDLE_VERSION")) CopyTextBounded(dst->Platform.macOS.bundleVersion, text, sizeof(dst->Platform.macOS.bundleVersion)); // Bundle version
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_EMSDK_PATH")) CopyTextBounded(dst->Platform.HTML5.emsdkPath, text, sizeof(dst->Platform.HTML5.emsdkPath)); // Path to emsdk, required for Web building
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_SHELL_FILE")) CopyTextBounded(dst->Platform.HTML5.shellFile, text, sizeof(dst->Platform.HTML5.shellFile)); // Path to shell file to be used by emscripten
         else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_HEAP_MEMORY_SIZE")) dst->Platform.HTML5.heapMemorySize = src.entries[i].value; // Required heap memory size in MB (required for assets loading)
         else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_FLAG_USE_ASINCIFY")) dst->Platform.HTML5.useAsincify = src.entries[i].value; // Flag: use ASINCIFY mode on building
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_FLAG_USE_WEBGL2")) dst->Platform.HTML5.useWebGL2, src.entries[i].value; // Flag: use WebGL2 (OpenGL ES 3.1) instead of default WebGL1 (OpenGL ES 2.0)
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_SDK_PATH")) TextCopy(dst->Platform.Android.sdkPath, src.entries[i].text); // Path to Android SDK, required for Android App building and support tools
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_NDK_PATH")) TextCopy(dst->Platform.Android.ndkPath, src.entries[i].text); // Path to Android NDK, required for C native building to Android
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_JAVA_SDK_PATH")) TextCopy(dst->Platform.Android.javaSdkPath, src.entries[i].text); // Path to Java SDK, required for some tools
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_MANIFEST_FILE")) TextCopy(dst->Platform.Android.manifestFile, src.entries[i].text); // Path to Android manifest, including build options
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_HTML5_FLAG_USE_WEBGL2")) dst->Platform.HTML5.useWebGL2 = src.entries[i].value; // Flag: use WebGL2 (OpenGL ES 3.1) instead of default WebGL1 (OpenGL ES 2.0)
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_SDK_PATH")) CopyTextBounded(dst->Platform.Android.sdkPath, text, sizeof(dst->Platform.Android.sdkPath)); // Path to Android SDK, required for Android App building and support tools
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_NDK_PATH")) CopyTextBounded(dst->Platform.Android.ndkPath, text, sizeof(dst->Platform.Android.ndkPath)); // Path to Android NDK, required for C native building to Android
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_JAVA_SDK_PATH")) CopyTextBounded(dst->Platform.Android.javaSdkPath, text, sizeof(dst->Platform.Android.javaSdkPath)); // Path to Java SDK, required for some tools
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_MANIFEST_FILE")) CopyTextBounded(dst->Platform.Android.manifestFile, text, sizeof(dst->Platform.Android.manifestFile)); // Path to Android manifest, including build options
         else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_MIN_SDK_VERSION")) dst->Platform.Android.minSdkVersion = src.entries[i].value; // Minimum SDK version required
         else if (TextIsEqual(src.entries[i].key, "PLATFORM_ANDROID_TARGET_SDK_VERSION")) dst->Platform.Android.targetSdkVersion = src.entries[i].value; // Target SDK version
         else if (TextIsEqual(src.entries[i].key, "PLATFORM_DRM_FLAG_CROSS_COMPILE")) dst->Platform.DRM.useCrossCompiler = src.entries[i].value; // Flag: request cross-compiler usage
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_DRM_CROSS_COMPILER_PATH")) TextCopy(dst->Platform.DRM.crossCompilerPath, src.entries[i].text); // Path to DRM cross-compiler for target ABI
-        else if (TextIsEqual(src.entries[i].key, "PLATFORM_DREAMCAST_SDK_PATH")) TextCopy(dst->Platform.Dreamcast.sdkPath, src.entries[i].text); // Path to Dreamcast SDK (KallistiOS), required for Dreamcast building
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_DRM_CROSS_COMPILER_PATH")) CopyTextBounded(dst->Platform.DRM.crossCompilerPath, text, sizeof(dst->Platform.DRM.crossCompilerPath)); // Path to DRM cross-compiler for target ABI
+        else if (TextIsEqual(src.entries[i].key, "PLATFORM_DREAMCAST_SDK_PATH")) CopyTextBounded(dst->Platform.Dreamcast.sdkPath, text, sizeof(dst->Platform.Dreamcast.sdkPath)); // Path to Dreamcast SDK (KallistiOS), required for Dreamcast building
         // DEPLOY properties mapping
         else if (TextIsEqual(src.entries[i].key, "DEPLOY_FLAG_ZIP_PACKAGE")) dst->Deploy.zipPackage = src.entries[i].value; // Flag: request package to be zipped for distribution
         else if (TextIsEqual(src.entries[i].key, "DEPLOY_FLAG_RIF_INSTALLER")) dst->Deploy.rifInstaller = src.entries[i].value; // Flag: request installer creation using rInstallFriendly tool
-        else if (TextIsEqual(src.entries[i].key, "DEPLOY_RIF_INSTALLER_PATH")) TextCopy(dst->Deploy.rifInstallerPath, src.entries[i].text); // Path to [rInstallFriendly] tool
-        else if (TextIsEqual(src.entries[i].key, "DEPLOY_FLAG_INCUDE_README")) dst->Deploy.includeREADME, src.entries[i].value; // Flag: include EULA file on package (vs LICENSE file for FOSS)
-        else if (TextIsEqual(src.entries[i].key, "DEPLOY_README_FILE")) TextCopy(dst->Deploy.readmePath, src.entries[i].text); // Project README document, contains product information
+        else if (TextIsEqual(src.entries[i].key, "DEPLOY_RIF_INSTALLER_PATH")) CopyTextBounded(dst->Deploy.rifInstallerPath, text, sizeof(dst->Deploy.rifInstallerPath)); // Path to [rInstallFriendly] tool
+        else if (TextIsEqual(src.entries[i].key, "DEPLOY_FLAG_INCUDE_README")) dst->Deploy.includeREADME = src.entries[i].value; // Flag: request including README file on package
+        else if (TextIsEqual(src.entries[i].key, "DEPLOY_README_FILE")) CopyTextBounded(dst->Deploy.readmePath, text, sizeof(dst->Deploy.readmePath)); // Project README document, contains product information
         else if (TextIsEqual(src.entries[i].key, "DEPLOY_FLAG_INCUDE_EULA")) dst->Deploy.includeEULA = src.entries[i].value; // Flag: include EULA file on package (vs LICENSE file for FOSS)
-        else if (TextIsEqual(src.entries[i].key, "DEPLOY_EULA_FILE")) TextCopy(dst->Deploy.eulaPath, src.entries[i].text); // Project End-User-License-Agreement
+        else if (TextIsEqual(src.entries[i].key, "DEPLOY_EULA_FILE")) CopyTextBounded(dst->Deploy.eulaPath, text, sizeof(dst->Deploy.eulaPath)); // Project End-User-License-Agreement
         // IMAGERY properties mapping
-        else if (TextIsEqual(src.entries[i].key, "IMAGERY_LOGO_FILE")) TextCopy(dst->Imagery.logoFile, src.entries[i].text); // Project logo image, useful for imagery generation
-        else if (TextIsEqual(src.entries[i].key, "IMAGERY_SPLASH_FILE")) TextCopy(dst->Imagery.splashFile, src.entries[i].text); // Project splash image, useful for imagery generation
+        else if (TextIsEqual(src.entries[i].key, "IMAGERY_LOGO_FILE")) CopyTextBounded(dst->Imagery.logoFile, text, sizeof(dst->Imagery.logoFile)); // Project logo image, useful for imagery generation
+        else if (TextIsEqual(src.entries[i].key, "IMAGERY_SPLASH_FILE")) CopyTextBounded(dst->Imagery.splashFile, text, sizeof(dst->Imagery.splashFile)); // Project splash image, useful for imagery generation
         else if (TextIsEqual(src.entries[i].key, "IMAGERY_FLAG_GENERATE")) dst->Imagery.genImageryAuto = src.entries[i].value; // Flag: request project imagery generation: Social Cards, itchio, Steam...
     }
 }
@@ -705,6 +1274,8 @@ void SyncProjectConfig(rpcProjectConfig *dst, rpcProjectConfigRaw src)
 // Update property entry value and text
 static void UpdateEntryValue(rpcPropertyEntry *entry, int value)
 {
+    if (entry->value != value) SetProjectConfigEntryChanged(entry);
+
     entry->value = value;
     TextCopy(entry->text, TextFormat("%i", value));
 }
@@ -713,7 +1284,26 @@ static void UpdateEntryValue(rpcPropertyEntry *entry, int value)
 // NOTE: Only updated text if provided, if not, using default value from template
 static void UpdateEntryText(rpcPropertyEntry *entry, const char *text)
 {
-    if ((text != NULL) && (text[0] != '\0')) TextCopy(entry->text, text);
+    if ((text != NULL) && (text[0] != '\0') && !TextIsEqual(GetEntryText(entry), text))
+    {
+        CopyTextBounded(entry->text, text, sizeof(entry->text));
+        SetEntryLongText(entry, text, (int)strlen(text));
+        SetProjectConfigEntryChanged(entry);
+    }
+}
+
+// Sync property entry text from config field (if changed)
+// NOTE: Config fields keep resolved text (possibly truncated to field size), field matching
+// entry resolved text is not changed and entry references (${KEY}) are kept
+static void SyncEntryText(rpcProjectConfigRaw raw, rpcPropertyEntry *entry, const char *text, int size)
+{
+    const char *resolved = GetProjectConfigEntryResolved(raw, entry);
+    int resolvedLength = (int)strlen(resolved);
+    if (resolvedLength > (size - 1)) resolvedLength = size - 1;
+
+    if (((int)strlen(text) == resolvedLength) && (strncmp(resolved, text, resolvedLength) == 0)) return;
+
+    UpdateEntryText(entry, text);
 }
 
 // Sync ProjectConfig data --> ProjectConfigRaw data
@@ -725,71 +1315,73 @@ void SyncProjectConfigRaw(rpcProjectConfigRaw dst, rpcProjectConfig *src)
     for (int i = 0; i < dst.entryCount; i++)
     {
         // PROJECT properties mapping
-        if (TextIsEqual(dst.entries[i].key, "PROJECT_INTERNAL_NAME")) UpdateEntryText(&dst.entries[i], src->Project.internalName); // Project intenal name, used for executable and project files
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_REPO_NAME")) UpdateEntryText(&dst.entries[i], src->Project.repoName); // Project repository name, used for VCS (GitHub, GitLab)
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_COMMERCIAL_NAME")) UpdateEntryText(&dst.entries[i], src->Project.commercialName); // Project commercial name, used for docs and web
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_SHORT_NAME")) UpdateEntryText(&dst.entries[i], src->Project.shortName); // Project short name
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_VERSION")) UpdateEntryText(&dst.entries[i], src->Project.version); // Project version
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DESCRIPTION")) UpdateEntryText(&dst.entries[i], src->Project.description); // Project description
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_PUBLISHER_NAME")) UpdateEntryText(&dst.entries[i], src->Project.publisherName); // Project publisher name
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DEVELOPER_NAME")) UpdateEntryText(&dst.entries[i], src->Project.developerName); // Project developer name
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DEVELOPER_URL")) UpdateEntryText(&dst.entries[i], src->Project.developerUrl); // Project developer webpage url
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DEVELOPER_EMAIL")) UpdateEntryText(&dst.entries[i], src->Project.developerEmail); // Project developer email
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_ICON_FILE")) UpdateEntryText(&dst.entries[i], src->Project.iconFile); // Project icon file
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_SOURCE_PATH")) UpdateEntryText(&dst.entries[i], src->Project.sourcePath); // Project source directory, including all required code files (C/C++)
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_ASSETS_PATH")) UpdateEntryText(&dst.entries[i], src->Project.assetsPath); // Project assets directory, including all required assets
-        else if (TextIsEqual(dst.entries[i].key, "PROJECT_ASSETS_OUTPUT_PATH")) UpdateEntryText(&dst.entries[i], src->Project.assetsOutPath); // Project assets destination path
+        if (TextIsEqual(dst.entries[i].key, "PROJECT_INTERNAL_NAME")) SyncEntryText(dst, &dst.entries[i], src->Project.internalName, sizeof(src->Project.internalName)); // Project intenal name, used for executable and project files
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_REPO_NAME")) SyncEntryText(dst, &dst.entries[i], src->Project.repoName, sizeof(src->Project.repoName)); // Project repository name, used for VCS (GitHub, GitLab)
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_COMMERCIAL_NAME")) SyncEntryText(dst, &dst.entries[i], src->Project.commercialName, sizeof(src->Project.commercialName)); // Project commercial name, used for docs and web
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_SHORT_NAME")) SyncEntryText(dst, &dst.entries[i], src->Project.shortName, sizeof(src->Project.shortName)); // Project short name
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_VERSION")) SyncEntryText(dst, &dst.entries[i], src->Project.version, sizeof(src->Project.version)); // Project version
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DESCRIPTION")) SyncEntryText(dst, &dst.entries[i], src->Project.description, sizeof(src->Project.description)); // Project description
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_PUBLISHER_NAME")) SyncEntryText(dst, &dst.entries[i], src->Project.publisherName, sizeof(src->Project.publisherName)); // Project publisher name
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DEVELOPER_NAME")) SyncEntryText(dst, &dst.entries[i], src->Project.developerName, sizeof(src->Project.developerName)); // Project developer name
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DEVELOPER_URL")) SyncEntryText(dst, &dst.entries[i], src->Project.developerUrl, sizeof(src->Project.developerUrl)); // Project developer webpage url
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_DEVELOPER_EMAIL")) SyncEntryText(dst, &dst.entries[i], src->Project.developerEmail, sizeof(src->Project.developerEmail)); // Project developer email
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_ICON_FILE")) SyncEntryText(dst, &dst.entries[i], src->Project.iconFile, sizeof(src->Project.iconFile)); // Project icon file
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_SOURCE_PATH")) SyncEntryText(dst, &dst.entries[i], src->Project.sourcePath, sizeof(src->Project.sourcePath)); // Project source directory, including all required code files (C/C++)
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_ASSETS_PATH")) SyncEntryText(dst, &dst.entries[i], src->Project.assetsPath, sizeof(src->Project.assetsPath)); // Project assets directory, including all required assets
+        else if (TextIsEqual(dst.entries[i].key, "PROJECT_ASSETS_OUTPUT_PATH")) SyncEntryText(dst, &dst.entries[i], src->Project.assetsOutPath, sizeof(src->Project.assetsOutPath)); // Project assets destination path
         // raylib properties mapping
-        else if (TextIsEqual(dst.entries[i].key, "RAYLIB_SRC_PATH")) UpdateEntryText(&dst.entries[i], src->raylib.srcPath); // Path to raylib source code, to be build for target platform
-        else if (TextIsEqual(dst.entries[i].key, "RAYLIB_OPENGL_VERSION")) UpdateEntryText(&dst.entries[i], src->raylib.glVersion); // OpenGL version to be used by raylib, WARNING: Platform dependant!
+        else if (TextIsEqual(dst.entries[i].key, "RAYLIB_SRC_PATH")) SyncEntryText(dst, &dst.entries[i], src->raylib.srcPath, sizeof(src->raylib.srcPath)); // Path to raylib source code, to be build for target platform
+        else if (TextIsEqual(dst.entries[i].key, "RAYLIB_OPENGL_VERSION")) SyncEntryText(dst, &dst.entries[i], src->raylib.glVersion, sizeof(src->raylib.glVersion)); // OpenGL version to be used by raylib, WARNING: Platform dependant!
         // BUILD properties mapping
-        else if (TextIsEqual(dst.entries[i].key, "BUILD_OUTPUT_PATH")) UpdateEntryText(&dst.entries[i], src->Build.outputPath); // Build output path
-        else if (TextIsEqual(dst.entries[i].key, "BUILD_TARGET_PLATFORM")) UpdateEntryText(&dst.entries[i], src->Build.targetPlatform); // Build target platform (Supported: Windows, Linux, macOS, Android, Web)
-        else if (TextIsEqual(dst.entries[i].key, "BUILD_TARGET_ARCHITECTURE")) UpdateEntryText(&dst.entries[i], src->Build.targetArchitecture); // Build target architecture (Supported: x86-64, Win32, arm64)
-        else if (TextIsEqual(dst.entries[i].key, "BUILD_TARGET_MODE")) UpdateEntryText(&dst.entries[i], src->Build.targetMode); // Build target mode (Supported: DEBUG, RELEASE, DEBUG_DLL, RELEASE_DLL)
+        else if (TextIsEqual(dst.entries[i].key, "BUILD_OUTPUT_PATH")) SyncEntryText(dst, &dst.entries[i], src->Build.outputPath, sizeof(src->Build.outputPath)); // Build output path
+        else if (TextIsEqual(dst.entries[i].key, "BUILD_TARGET_PLATFORM")) SyncEntryText(dst, &dst.entries[i], src->Build.targetPlatform, sizeof(src->Build.targetPlatform)); // Build target platform (Supported: Windows, Linux, macOS, Android, Web)
+        else if (TextIsEqual(dst.entries[i].key, "BUILD_TARGET_ARCHITECTURE")) SyncEntryText(dst, &dst.entries[i], src->Build.targetArchitecture, sizeof(src->Build.targetArchitecture)); // Build target architecture (Supported: x86-64, Win32, arm64)
+        else if (TextIsEqual(dst.entries[i].key, "BUILD_TARGET_MODE")) SyncEntryText(dst, &dst.entries[i], src->Build.targetMode, sizeof(src->Build.targetMode)); // Build target mode (Supported: DEBUG, RELEASE, DEBUG_DLL, RELEASE_DLL)
         else if (TextIsEqual(dst.entries[i].key, "BUILD_FLAG_ASSETS_VALIDATION")) UpdateEntryValue(&dst.entries[i], src->Build.assetsValidation); // Flag: request assets validation on building
         else if (TextIsEqual(dst.entries[i].key, "BUILD_FLAG_ASSETS_PACKAGING")) UpdateEntryValue(&dst.entries[i], src->Build.assetsPackaging); // Flag: request assets packaging on building
         // PLATFORM properties mapping
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_MSBUILD_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Windows.msbuildPath); // Path to MSBuild system, required to build VS2022 solution
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_W64DEVKIT_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Windows.w64devkitPath); // Path to w64devkit (GCC), required to use Makefile building
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_SIGNTOOL_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Windows.signtoolPath); // Path to signtool in case program needs to be signed (certificate required)
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_SIGNCERT_FILE")) UpdateEntryText(&dst.entries[i], src->Platform.Windows.signCertFile); // Path to a valid signature certificate to sign executable
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_MSBUILD_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Windows.msbuildPath, sizeof(src->Platform.Windows.msbuildPath)); // Path to MSBuild system, required to build VS2022 solution
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_W64DEVKIT_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Windows.w64devkitPath, sizeof(src->Platform.Windows.w64devkitPath)); // Path to w64devkit (GCC), required to use Makefile building
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_SIGNTOOL_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Windows.signtoolPath, sizeof(src->Platform.Windows.signtoolPath)); // Path to signtool in case program needs to be signed (certificate required)
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_WINDOWS_SIGNCERT_FILE")) SyncEntryText(dst, &dst.entries[i], src->Platform.Windows.signCertFile, sizeof(src->Platform.Windows.signCertFile)); // Path to a valid signature certificate to sign executable
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_LINUX_FLAG_CROSS_COMPILE")) UpdateEntryValue(&dst.entries[i], src->Platform.Linux.useCrossCompiler); // Flag: request cross-compiler usage
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_LINUX_CROSS_COMPILER_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Linux.crossCompilerPath); // Path to GCC compiler (probably not required)
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_MACOS_BUNDLE_INFO_FILE")) UpdateEntryText(&dst.entries[i], src->Platform.macOS.bundleInfoFile); // Path to macOS bundle options (Info.plist)
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_MACOS_BUNDLE_NAME")) UpdateEntryText(&dst.entries[i], src->Platform.macOS.bundleName); // Bundle name
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_MACOS_BUNDLE_VERSION")) UpdateEntryText(&dst.entries[i], src->Platform.macOS.bundleVersion); // Bundle version
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_EMSDK_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.HTML5.emsdkPath); // Path to emsdk, required for Web building
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_SHELL_FILE")) UpdateEntryText(&dst.entries[i], src->Platform.HTML5.shellFile); // Path to shell file to be used by emscripten
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_LINUX_CROSS_COMPILER_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Linux.crossCompilerPath, sizeof(src->Platform.Linux.crossCompilerPath)); // Path to GCC compiler (probably not required)
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_MACOS_BUNDLE_INFO_FILE")) SyncEntryText(dst, &dst.entries[i], src->Platform.macOS.bundleInfoFile, sizeof(src->Platform.macOS.bundleInfoFile)); // Path to macOS bundle options (Info.plist)
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_MACOS_BUNDLE_NAME")) SyncEntryText(dst, &dst.entries[i], src->Platform.macOS.bundleName, sizeof(src->Platform.macOS.bundleName)); // Bundle name
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_MACOS_BUNDLE_VERSION")) SyncEntryText(dst, &dst.entries[i], src->Platform.macOS.bundleVersion, sizeof(src->Platform.macOS.bundleVersion)); // Bundle version
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_EMSDK_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.HTML5.emsdkPath, sizeof(src->Platform.HTML5.emsdkPath)); // Path to emsdk, required for Web building
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_SHELL_FILE")) SyncEntryText(dst, &dst.entries[i], src->Platform.HTML5.shellFile, sizeof(src->Platform.HTML5.shellFile)); // Path to shell file to be used by emscripten
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_HEAP_MEMORY_SIZE")) UpdateEntryValue(&dst.entries[i], src->Platform.HTML5.heapMemorySize); // Required heap memory size in MB (required for assets loading)
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_FLAG_USE_ASINCIFY")) UpdateEntryValue(&dst.entries[i], src->Platform.HTML5.useAsincify); // Flag: use ASINCIFY mode on building
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_HTML5_FLAG_USE_WEBGL2")) UpdateEntryValue(&dst.entries[i], src->Platform.HTML5.useWebGL2); // Flag: use WebGL2 (OpenGL ES 3.1) instead of default WebGL1 (OpenGL ES 2.0)
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_SDK_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Android.sdkPath); // Path to Android SDK, required for Android App building and support tools
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_NDK_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Android.ndkPath); // Path to Android NDK, required for C native building to Android
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_JAVA_SDK_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Android.javaSdkPath); // Path to Java SDK, required for some tools
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_MANIFEST_FILE")) UpdateEntryText(&dst.entries[i], src->Platform.Android.manifestFile); // Path to Android manifest, including build options
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_SDK_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Android.sdkPath, sizeof(src->Platform.Android.sdkPath)); // Path to Android SDK, required for Android App building and support tools
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_NDK_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Android.ndkPath, sizeof(src->Platform.Android.ndkPath)); // Path to Android NDK, required for C native building to Android
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_JAVA_SDK_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Android.javaSdkPath, sizeof(src->Platform.Android.javaSdkPath)); // Path to Java SDK, required for some tools
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_MANIFEST_FILE")) SyncEntryText(dst, &dst.entries[i], src->Platform.Android.manifestFile, sizeof(src->Platform.Android.manifestFile)); // Path to Android manifest, including build options
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_MIN_SDK_VERSION")) UpdateEntryValue(&dst.entries[i], src->Platform.Android.minSdkVersion); // Minimum SDK version required
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_ANDROID_TARGET_SDK_VERSION")) UpdateEntryValue(&dst.entries[i], src->Platform.Android.targetSdkVersion); // Target SDK version
         else if (TextIsEqual(dst.entries[i].key, "PLATFORM_DRM_FLAG_CROSS_COMPILE")) UpdateEntryValue(&dst.entries[i], src->Platform.DRM.useCrossCompiler); // Flag: request cross-compiler usage
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_DRM_CROSS_COMPILER_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.DRM.crossCompilerPath); // Path to DRM cross-compiler for target ABI
-        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_DREAMCAST_SDK_PATH")) UpdateEntryText(&dst.entries[i], src->Platform.Dreamcast.sdkPath); // Path to Dreamcast SDK (KallistiOS), required for Dreamcast building
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_DRM_CROSS_COMPILER_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.DRM.crossCompilerPath, sizeof(src->Platform.DRM.crossCompilerPath)); // Path to DRM cross-compiler for target ABI
+        else if (TextIsEqual(dst.entries[i].key, "PLATFORM_DREAMCAST_SDK_PATH")) SyncEntryText(dst, &dst.entries[i], src->Platform.Dreamcast.sdkPath, sizeof(src->Platform.Dreamcast.sdkPath)); // Path to Dreamcast SDK (KallistiOS), required for Dreamcast building
         // DEPLOY properties mapping
         else if (TextIsEqual(dst.entries[i].key, "DEPLOY_FLAG_ZIP_PACKAGE")) UpdateEntryValue(&dst.entries[i], src->Deploy.zipPackage); // Flag: request package to be zipped for distribution
         else if (TextIsEqual(dst.entries[i].key, "DEPLOY_FLAG_RIF_INSTALLER")) UpdateEntryValue(&dst.entries[i], src->Deploy.rifInstaller); // Flag: request installer creation using rInstallFriendly tool
-        else if (TextIsEqual(dst.entries[i].key, "DEPLOY_RIF_INSTALLER_PATH")) UpdateEntryText(&dst.entries[i], src->Deploy.rifInstallerPath); // Path to [rInstallFriendly] tool
+        else if (TextIsEqual(dst.entries[i].key, "DEPLOY_RIF_INSTALLER_PATH")) SyncEntryText(dst, &dst.entries[i], src->Deploy.rifInstallerPath, sizeof(src->Deploy.rifInstallerPath)); // Path to [rInstallFriendly] tool
         else if (TextIsEqual(dst.entries[i].key, "DEPLOY_FLAG_INCUDE_README")) UpdateEntryValue(&dst.entries[i], src->Deploy.includeREADME); // Flag: include EULA file on package (vs LICENSE file for FOSS)
-        else if (TextIsEqual(dst.entries[i].key, "DEPLOY_README_FILE")) UpdateEntryText(&dst.entries[i], src->Deploy.readmePath); // Project README document, contains product information
+        else if (TextIsEqual(dst.entries[i].key, "DEPLOY_README_FILE")) SyncEntryText(dst, &dst.entries[i], src->Deploy.readmePath, sizeof(src->Deploy.readmePath)); // Project README document, contains product information
         else if (TextIsEqual(dst.entries[i].key, "DEPLOY_FLAG_INCUDE_EULA")) UpdateEntryValue(&dst.entries[i], src->Deploy.includeEULA); // Flag: include EULA file on package (vs LICENSE file for FOSS)
-        else if (TextIsEqual(dst.entries[i].key, "DEPLOY_EULA_FILE")) UpdateEntryText(&dst.entries[i], src->Deploy.eulaPath); // Project End-User-License-Agreement
+        else if (TextIsEqual(dst.entries[i].key, "DEPLOY_EULA_FILE")) SyncEntryText(dst, &dst.entries[i], src->Deploy.eulaPath, sizeof(src->Deploy.eulaPath)); // Project End-User-License-Agreement
         // IMAGERY properties mapping
-        else if (TextIsEqual(dst.entries[i].key, "IMAGERY_LOGO_FILE")) UpdateEntryText(&dst.entries[i], src->Imagery.logoFile); // Project logo image, useful for imagery generation
-        else if (TextIsEqual(dst.entries[i].key, "IMAGERY_SPLASH_FILE")) UpdateEntryText(&dst.entries[i], src->Imagery.splashFile); // Project splash image, useful for imagery generation
+        else if (TextIsEqual(dst.entries[i].key, "IMAGERY_LOGO_FILE")) SyncEntryText(dst, &dst.entries[i], src->Imagery.logoFile, sizeof(src->Imagery.logoFile)); // Project logo image, useful for imagery generation
+        else if (TextIsEqual(dst.entries[i].key, "IMAGERY_SPLASH_FILE")) SyncEntryText(dst, &dst.entries[i], src->Imagery.splashFile, sizeof(src->Imagery.splashFile)); // Project splash image, useful for imagery generation
         else if (TextIsEqual(dst.entries[i].key, "IMAGERY_FLAG_GENERATE")) UpdateEntryValue(&dst.entries[i], src->Imagery.genImageryAuto); // Flag: request project imagery generation: Social Cards, itchio, Steam...
     }
 }
 
 // Get project config text by key
-// NOTE: A pointer to the text is returned to allow modifying it
+// NOTE: A pointer to the text is returned to allow modifying it, it is the entry text buffer (255 chars max),
+// longer texts are kept by entry until text is modified
+// WARNING: Entries inherited from base config are shared, use SetProjectConfigText() to override them
 char *GetProjectConfigText(rpcProjectConfigRaw raw, const char *key)
 {
     for (int i = 0; i < raw.entryCount; i++)
@@ -797,19 +1389,1452 @@ char *GetProjectConfigText(rpcProjectConfigRaw raw, const char *key)
         if (TextIsEqual(raw.entries[i].key, key)) return raw.entries[i].text;
     }
 
+    if (raw.base != NULL) return GetProjectConfigText(*raw.base, key);
+
     return NULL;
 }
 
 // Get project config value by key
 // NOTE: A pointer to the value is returned to allow modifying it
+// WARNING: Entries inherited from base config are shared, use SetProjectConfigValue() to override them
 int *GetProjectConfigValue(rpcProjectConfigRaw raw, const char *key)
 {
     for (int i = 0; i < raw.entryCount; i++)
     {
         if (TextIsEqual(raw.entries[i].key, key)) return &raw.entries[i].value;
     }
-    
+
+    if (raw.base != NULL) return GetProjectConfigValue(*raw.base, key);
+
     return NULL;
 }
 
+// Set project config text by key
+// NOTE: Entry inherited from base config is copied into project entries before writing (copy-on-write)
+// WARNING: Entries can be reallocated on copy, previous entries pointers are invalidated
+bool SetProjectConfigText(rpcProjectConfigRaw *raw, const char *key, const char *text)
+{
+    rpcPropertyEntry *entry = GetProjectConfigEntryWrite(raw, key);
+
+    if ((entry == NULL) || (text == NULL)) return false;
+
+    if (!TextIsEqual(GetEntryText(entry), text))
+    {
+        memset(entry->text, 0, sizeof(entry->text));
+        strncpy(entry->text, text, sizeof(entry->text) - 1);
+        SetEntryLongText(entry, text, (int)strlen(text));
+        SetProjectConfigEntryChanged(entry);
+    }
+
+    return true;
+}
+
+
+// Get project config text by key, references resolved
+// NOTE: Supported references: ${KEY} for config entries, environment variable used if key
+// is not defined in config, unknown references are kept as is
+// NOTE: Entries inherited from base config resolve references against project entries, resolved text
+// is memoized on base entry for last project requesting it (valid until resolved for another project)
+const char *GetProjectConfigTextResolved(rpcProjectConfigRaw raw, const char *key)
+{
+    int ref = 0;
+    rpcPropertyEntry *entry = FindProjectConfigEntryRef(raw, key, &ref);
+
+    if (entry == NULL) return NULL;
+
+    return ResolveEntryTextMemo(raw, entry, NULL);
+}
+
+// Get project config entry text, references resolved
+// NOTE: Resolved text is memoized on entry, only resolved again when entry or any referenced entry changes,
+// returned text is owned by entry, no length limit (long text supported)
+const char *GetProjectConfigEntryResolved(rpcProjectConfigRaw raw, rpcPropertyEntry *entry)
+{
+    return ResolveEntryTextMemo(raw, entry, NULL);
+}
+
+// Set project config entry as changed
+// NOTE: Entry is marked for saving and memoized resolved texts referencing it are invalidated
+void SetProjectConfigEntryChanged(rpcPropertyEntry *entry)
+{
+    entryRevisionCounter++;
+    entry->revision = entryRevisionCounter;
+    entry->dirty = true;
+}
+
+// Set project config value by key
+// NOTE: Entry inherited from base config is copied into project entries before writing (copy-on-write)
+// WARNING: Entries can be reallocated on copy, previous entries pointers are invalidated
+bool SetProjectConfigValue(rpcProjectConfigRaw *raw, const char *key, int value)
+{
+    rpcPropertyEntry *entry = GetProjectConfigEntryWrite(raw, key);
+
+    if (entry == NULL) return false;
+
+    UpdateEntryValue(entry, value);
+
+    return true;
+}
+
+// Load project config raw data, including entries inherited from base config(s)
+// NOTE: Base config file is defined by RPC_BASE_FILE_KEY entry, returned data is flattened,
+// inherited entries are marked to be only saved if changed
+rpcProjectConfigRaw LoadProjectConfigRawResolved(const char *fileName)
+{
+    rpcProjectConfigRaw chain[RPC_MAX_INHERIT_DEPTH] = { 0 };
+    char chainFileNames[RPC_MAX_INHERIT_DEPTH][512] = { 0 };
+    int depth = 0;
+
+    strncpy(chainFileNames[0], fileName, 511);
+
+    // Load inheritance chain: project, base, base of base...
+    while ((depth < RPC_MAX_INHERIT_DEPTH) && FileExists(chainFileNames[depth]))
+    {
+        chain[depth] = LoadProjectConfigRaw(chainFileNames[depth]);
+        depth++;
+
+        rpcPropertyEntry *baseEntry = FindProjectConfigEntry(chain[depth - 1], RPC_BASE_FILE_KEY);
+        if ((baseEntry == NULL) || (baseEntry->text[0] == '\0') || (depth == RPC_MAX_INHERIT_DEPTH)) break;
+
+        strncpy(chainFileNames[depth], GetBaseFilePath(chainFileNames[depth - 1], baseEntry->text), 511);
+
+        // Check for inheritance cycles
+        bool cycle = false;
+        for (int i = 0; i < depth; i++) if (TextIsEqual(chainFileNames[i], chainFileNames[depth])) cycle = true;
+
+        if (cycle)
+        {
+            TraceLog(LOG_WARNING, "RPC: [%s] Base config inheritance cycle detected", chainFileNames[depth]);
+            break;
+        }
+
+        if (!FileExists(chainFileNames[depth]))
+        {
+            TraceLog(LOG_WARNING, "RPC: [%s] Base config file not found", chainFileNames[depth]);
+            break;
+        }
+    }
+
+    for (int i = 0; i < (depth - 1); i++) chain[i].base = &chain[i + 1];
+
+    rpcProjectConfigRaw raw = ResolveProjectConfigRaw(chain[0]);
+
+    for (int i = 0; i < depth; i++) UnloadProjectConfigRaw(chain[i]);
+
+    return raw;
+}
+
+// Load projects workspace from .rpw file
+// NOTE: Workspace file lists projects with WORKSPACE_PROJECT_FILE entries and optionally a default
+// base config with WORKSPACE_BASE_FILE entry, projects RPC_BASE_FILE_KEY entry takes precedence,
+// every base config is loaded only once and shared by all the projects referencing it
+rpcProjectWorkspace LoadProjectWorkspace(const char *fileName)
+{
+    rpcProjectWorkspace workspace = { 0 };
+
+    if (!FileExists(fileName)) return workspace;
+
+    rini_data data = rini_load(fileName);
+
+    for (unsigned int i = 0; i < data.count; i++)
+    {
+        if (TextIsEqual(data.values[i].key, "WORKSPACE_PROJECT_FILE")) workspace.projectCount++;
+    }
+
+    if (workspace.projectCount > 0)
+    {
+        // NOTE: Every project can add at maximum RPC_MAX_INHERIT_DEPTH new base configs
+        int maxBaseCount = workspace.projectCount*RPC_MAX_INHERIT_DEPTH + 1;
+
+        workspace.projects = (rpcProjectConfigRaw *)RL_CALLOC(workspace.projectCount, sizeof(rpcProjectConfigRaw));
+        workspace.projectFileNames = (char (*)[512])RL_CALLOC(workspace.projectCount, 512);
+        workspace.bases = (rpcProjectConfigRaw *)RL_CALLOC(maxBaseCount, sizeof(rpcProjectConfigRaw));
+        workspace.baseFileNames = (char (*)[512])RL_CALLOC(maxBaseCount, 512);
+
+        char defaultBaseFileName[512] = { 0 };
+        const char *defaultBase = rini_get_value_text(data, "WORKSPACE_BASE_FILE");
+        if ((defaultBase != NULL) && (defaultBase[0] != '\0')) strncpy(defaultBaseFileName, GetBaseFilePath(fileName, defaultBase), 511);
+
+        for (unsigned int i = 0, k = 0; i < data.count; i++)
+        {
+            if (!TextIsEqual(data.values[i].key, "WORKSPACE_PROJECT_FILE")) continue;
+
+            strncpy(workspace.projectFileNames[k], GetBaseFilePath(fileName, data.values[i].text), 511);
+            workspace.projects[k] = LoadProjectConfigRaw(workspace.projectFileNames[k]);
+
+            rpcPropertyEntry *baseEntry = FindProjectConfigEntry(workspace.projects[k], RPC_BASE_FILE_KEY);
+
+            if ((baseEntry != NULL) && (baseEntry->text[0] != '\0'))
+            {
+                char baseFileName[512] = { 0 };
+                strncpy(baseFileName, GetBaseFilePath(workspace.projectFileNames[k], baseEntry->text), 511);
+
+                workspace.projects[k].base = LoadWorkspaceBase(&workspace, baseFileName, 0);
+            }
+            else if (defaultBaseFileName[0] != '\0') workspace.projects[k].base = LoadWorkspaceBase(&workspace, defaultBaseFileName, 0);
+
+            k++;
+        }
+    }
+
+    rini_unload(&data);
+
+    return workspace;
+}
+
+// Unload projects workspace
+void UnloadProjectWorkspace(rpcProjectWorkspace workspace)
+{
+    for (int i = 0; i < workspace.projectCount; i++) UnloadProjectConfigRaw(workspace.projects[i]);
+    for (int i = 0; i < workspace.baseCount; i++) UnloadProjectConfigRaw(workspace.bases[i]);
+
+    RL_FREE(workspace.projects);
+    RL_FREE(workspace.projectFileNames);
+    RL_FREE(workspace.bases);
+    RL_FREE(workspace.baseFileNames);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load project config raw data from binary cache
+// NOTE: No parsing required but entries data is copied into rpcPropertyEntry (editable, transient data),
+// use rpcProjectConfigBinary entries directly for read-only access to mapped data
+static rpcProjectConfigRaw LoadProjectConfigRawFromBinary(rpcProjectConfigBinary bin)
+{
+    rpcProjectConfigRaw raw = { 0 };
+
+    // NOTE: Keeping at least RPC_MAX_PROPERTY_ENTRIES_RAW entries, as LoadProjectConfigRawFromText()
+    raw.entryCount = ((int)bin.header->entryCount > RPC_MAX_PROPERTY_ENTRIES_RAW)? (int)bin.header->entryCount : RPC_MAX_PROPERTY_ENTRIES_RAW;
+    raw.entries = (rpcPropertyEntry *)RL_CALLOC(raw.entryCount, sizeof(rpcPropertyEntry));
+    raw.id = ++configIdCounter;
+
+    for (unsigned int i = 0; i < bin.header->entryCount; i++)
+    {
+        const rpcBinaryEntry *entry = &bin.entries[i];
+
+        strncpy(raw.entries[i].key, bin.strings + entry->keyOffset, sizeof(raw.entries[i].key) - 1);
+        strncpy(raw.entries[i].text, bin.strings + entry->textOffset, sizeof(raw.entries[i].text) - 1);
+        SetEntryLongText(&raw.entries[i], bin.strings + entry->textOffset, (int)strlen(bin.strings + entry->textOffset));
+        strncpy(raw.entries[i].desc, bin.strings + entry->descOffset, sizeof(raw.entries[i].desc) - 1);
+        strncpy(raw.entries[i].name, bin.strings + entry->nameOffset, sizeof(raw.entries[i].name) - 1);
+        raw.entries[i].category = entry->category;
+        raw.entries[i].platform = entry->platform;
+        raw.entries[i].type = entry->type;
+        raw.entries[i].value = entry->value;
+    }
+
+    return raw;
+}
+
+// Regenerate binary cache (.rpcb) from saved .rpc file
+// NOTE: Cache is generated from file text (not from raw data), saved data could not include inherited
+// entries and incremental saving keeps other file lines, cache must match what loading the file returns
+static void UpdateProjectConfigBinaryCache(const char *fileName)
+{
+#if defined(RPC_SUPPORT_BINARY_CACHE)
+    char *text = LoadFileText(fileName);
+
+    if (text != NULL)
+    {
+        const char *cacheFileName = IsFileExtension(fileName, ".rpc")? TextFormat("%sb", fileName) : TextFormat("%s.rpcb", fileName);
+        rpcProjectConfigRaw raw = LoadProjectConfigRawFromText(text);
+        unsigned int sourceHash = ComputeCRC32((unsigned char *)text, (int)strlen(text));
+
+        SaveProjectConfigBinaryEx(raw, cacheFileName, sourceHash, (unsigned int)GetFileLength(fileName), (long long)GetFileModTime(fileName));
+
+        UnloadProjectConfigRaw(raw);
+        UnloadFileText(text);
+    }
+#else
+    (void)fileName;
+#endif
+}
+
+// Save project config binary cache to .rpcb file
+// NOTE: Only entries with a valid key are saved, empty strings share pool offset 0
+static bool SaveProjectConfigBinaryEx(rpcProjectConfigRaw raw, const char *fileName, unsigned int sourceHash, unsigned int sourceSize, long long sourceModTime)
+{
+    int entryCount = 0;
+    int poolSize = 1;
+
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        if (raw.entries[i].key[0] == '\0') continue;
+
+        entryCount++;
+        poolSize += (int)(strlen(raw.entries[i].key) + strlen(GetEntryText(&raw.entries[i])) + strlen(raw.entries[i].desc) + strlen(raw.entries[i].name)) + 4;
+    }
+
+    int dataSize = sizeof(rpcBinaryHeader) + entryCount*sizeof(rpcBinaryEntry) + poolSize;
+    unsigned char *data = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+    rpcBinaryHeader *header = (rpcBinaryHeader *)data;
+    rpcBinaryEntry *entries = (rpcBinaryEntry *)(data + sizeof(rpcBinaryHeader));
+    char *strings = (char *)(entries + entryCount);
+
+    memcpy(header->id, "rPCB", 4);
+    header->version = RPC_BINARY_CACHE_VERSION;
+    header->entrySize = sizeof(rpcBinaryEntry);
+    header->sourceHash = sourceHash;
+    header->sourceSize = sourceSize;
+    header->sourceModTime = sourceModTime;
+    header->entryCount = entryCount;
+    header->poolSize = poolSize;
+
+    unsigned int offset = 1;    // Offset 0 reserved for empty strings
+    const char *texts[4] = { 0 };
+    unsigned int *offsets[4] = { 0 };
+
+    for (int i = 0, k = 0; i < raw.entryCount; i++)
+    {
+        if (raw.entries[i].key[0] == '\0') continue;
+
+        texts[0] = raw.entries[i].key; offsets[0] = &entries[k].keyOffset;
+        texts[1] = GetEntryText(&raw.entries[i]); offsets[1] = &entries[k].textOffset;
+        texts[2] = raw.entries[i].desc; offsets[2] = &entries[k].descOffset;
+        texts[3] = raw.entries[i].name; offsets[3] = &entries[k].nameOffset;
+
+        for (int t = 0; t < 4; t++)
+        {
+            int len = (int)strlen(texts[t]);
+
+            if (len > 0)
+            {
+                *offsets[t] = offset;
+                memcpy(strings + offset, texts[t], len);
+                offset += (len + 1);
+            }
+            else *offsets[t] = 0;
+        }
+
+        entries[k].category = raw.entries[i].category;
+        entries[k].platform = raw.entries[i].platform;
+        entries[k].type = raw.entries[i].type;
+        entries[k].value = raw.entries[i].value;
+        k++;
+    }
+
+    // NOTE: Cache file can be memory mapped by other processes, it is replaced atomically, never truncated in place
+    bool success = SaveFileDataAtomic(fileName, data, dataSize);
+
+    RL_FREE(data);
+
+    return success;
+}
+
+// Get base file path, relative to file directory
+// NOTE: Path is normalized (removing "." and ".." elements) so same file is always referenced
+// with the same path, absolute paths are only normalized
+static const char *GetBaseFilePath(const char *fileName, const char *baseFileName)
+{
+    static char path[512] = { 0 };
+    char fullPath[512] = { 0 };
+
+    if ((baseFileName[0] == '/') || (baseFileName[0] == '\\') || ((baseFileName[0] != '\0') && (baseFileName[1] == ':'))) strncpy(fullPath, baseFileName, 511);
+    else strncpy(fullPath, TextFormat("%s/%s", GetDirectoryPath(fileName), baseFileName), 511);
+
+    memset(path, 0, 512);
+    int length = 0;
+    int rootLength = ((fullPath[0] == '/') || (fullPath[0] == '\\'))? 1 : 0;
+
+    if (rootLength > 0) path[length++] = '/';
+
+    for (int i = rootLength; fullPath[i] != '\0';)
+    {
+        // Get next path element
+        int elementLength = 0;
+        while ((fullPath[i + elementLength] != '\0') && (fullPath[i + elementLength] != '/') && (fullPath[i + elementLength] != '\\')) elementLength++;
+
+        const char *element = fullPath + i;
+        i += elementLength;
+        if (fullPath[i] != '\0') i++;
+
+        if ((elementLength == 0) || ((elementLength == 1) && (element[0] == '.'))) continue;
+
+        // Remove previous element, if available and not also a ".." element
+        if ((elementLength == 2) && (element[0] == '.') && (element[1] == '.'))
+        {
+            int prev = length;
+            while ((prev > rootLength) && (path[prev - 1] != '/')) prev--;
+
+            bool prevIsParent = ((length - prev) == 2) && (path[prev] == '.') && (path[prev + 1] == '.');
+
+            if ((length > rootLength) && !prevIsParent)
+            {
+                length = (prev > rootLength)? prev - 1 : rootLength;
+                path[length] = '\0';
+                continue;
+            }
+        }
+
+        if (length > rootLength) path[length++] = '/';
+        memcpy(path + length, element, elementLength);
+        length += elementLength;
+        path[length] = '\0';
+    }
+
+    return path;
+}
+
+// Find entry by key, own entries only (no base config fallback)
+static rpcPropertyEntry *FindProjectConfigEntry(rpcProjectConfigRaw raw, const char *key)
+{
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        if (TextIsEqual(raw.entries[i].key, key)) return &raw.entries[i];
+    }
+
+    return NULL;
+}
+
+// Get entry for writing
+// NOTE: Entry inherited from base config is copied into project entries (copy-on-write),
+// base config entries are shared and never modified
+// WARNING: Copying an entry can reallocate raw->entries, previous entries pointers (and raw copies) are invalidated
+static rpcPropertyEntry *GetProjectConfigEntryWrite(rpcProjectConfigRaw *raw, const char *key)
+{
+    rpcPropertyEntry *entry = FindProjectConfigEntry(*raw, key);
+
+    if (entry == NULL)
+    {
+        const rpcPropertyEntry *baseEntry = NULL;
+        for (rpcProjectConfigRaw *base = raw->base; (base != NULL) && (baseEntry == NULL); base = base->base) baseEntry = FindProjectConfigEntry(*base, key);
+
+        if (baseEntry != NULL)
+        {
+            // Look for an empty entry slot, grow entries if not available
+            for (int i = 0; i < raw->entryCount; i++) if (raw->entries[i].key[0] == '\0') { entry = &raw->entries[i]; break; }
+
+            // NOTE: Entries grow geometrically, new entries are empty slots for next copies
+            if (entry == NULL)
+            {
+                int entryCount = (raw->entryCount > 0)? raw->entryCount*2 : RPC_MAX_PROPERTY_ENTRIES_RAW;
+                rpcPropertyEntry *entries = (rpcPropertyEntry *)RL_REALLOC(raw->entries, entryCount*sizeof(rpcPropertyEntry));
+
+                if (entries == NULL)
+                {
+                    TraceLog(LOG_WARNING, "RPC: [%s] Failed to allocate project config entries", key);
+                    return NULL;
+                }
+
+                memset(entries + raw->entryCount, 0, (entryCount - raw->entryCount)*sizeof(rpcPropertyEntry));
+                entry = &entries[raw->entryCount];
+                raw->entries = entries;
+                raw->entryCount = entryCount;
+            }
+
+            RL_FREE(entry->longText);
+            RL_FREE(entry->resolved);
+
+            *entry = *baseEntry;
+            entry->longText = NULL;     // Base entry long text is not shared
+            if (baseEntry->longText != NULL) SetEntryLongText(entry, baseEntry->longText, (int)strlen(baseEntry->longText));
+            entry->resolved = NULL;     // Base entry resolved text is not shared
+            entry->inherited = false;
+            entry->editMode = false;
+            entry->resolvedValid = false;
+            SetProjectConfigEntryChanged(entry);
+
+            // New project entry overrides base entry, previously resolved references could point to it
+            layoutRevision = entryRevisionCounter;
+        }
+    }
+    else entry->inherited = false;  // Resolved inherited entry becomes an override
+
+    return entry;
+}
+
+// Flatten project config with base configs entries
+// NOTE: Base entries keep their order, project entries override them or are added at the end
+static rpcProjectConfigRaw ResolveProjectConfigRaw(rpcProjectConfigRaw raw)
+{
+    rpcProjectConfigRaw resolved = { 0 };
+
+    if (raw.base != NULL)
+    {
+        resolved = ResolveProjectConfigRaw(*raw.base);
+
+        for (int i = 0; i < resolved.entryCount; i++)
+        {
+            // Base config of base is not inherited
+            if (TextIsEqual(resolved.entries[i].key, RPC_BASE_FILE_KEY))
+            {
+                RL_FREE(resolved.entries[i].longText);
+                RL_FREE(resolved.entries[i].resolved);
+                memset(&resolved.entries[i], 0, sizeof(rpcPropertyEntry));
+            }
+            else resolved.entries[i].inherited = true;
+        }
+    }
+
+    int count = 0;
+    for (int i = 0; i < resolved.entryCount; i++) if (resolved.entries[i].key[0] != '\0') count++;
+    for (int i = 0; i < raw.entryCount; i++) if (raw.entries[i].key[0] != '\0') count++;
+
+    // NOTE: Keeping at least RPC_MAX_PROPERTY_ENTRIES_RAW entries, as LoadProjectConfigRaw()
+    int entryCount = (count > RPC_MAX_PROPERTY_ENTRIES_RAW)? count : RPC_MAX_PROPERTY_ENTRIES_RAW;
+    rpcPropertyEntry *entries = (rpcPropertyEntry *)RL_CALLOC(entryCount, sizeof(rpcPropertyEntry));
+    int k = 0;
+
+    for (int i = 0; i < resolved.entryCount; i++) if (resolved.entries[i].key[0] != '\0') entries[k++] = resolved.entries[i];
+
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        if (raw.entries[i].key[0] == '\0') continue;
+
+        rpcPropertyEntry *entry = NULL;
+        for (int j = 0; j < k; j++) if (TextIsEqual(entries[j].key, raw.entries[i].key)) { entry = &entries[j]; break; }
+        if (entry == NULL) entry = &entries[k++];
+        else
+        {
+            // Overridden base entry
+            RL_FREE(entry->longText);
+            RL_FREE(entry->resolved);
+        }
+
+        // NOTE: Resolved entries own their long text, raw entries are not modified
+        *entry = raw.entries[i];
+        entry->longText = NULL;
+        if (raw.entries[i].longText != NULL) SetEntryLongText(entry, raw.entries[i].longText, (int)strlen(raw.entries[i].longText));
+        entry->resolved = NULL;
+        entry->inherited = false;
+    }
+
+    // Memoized resolved texts reference entries by index, not valid anymore
+    for (int i = 0; i < k; i++) entries[i].resolvedValid = false;
+
+    RL_FREE(resolved.entries);
+
+    resolved.entries = entries;
+    resolved.entryCount = entryCount;
+    resolved.base = NULL;
+    resolved.id = ++configIdCounter;
+
+    return resolved;
+}
+
+// Load (or reuse) workspace base config
+// NOTE: Base configs are loaded once, following inheritance chain up to RPC_MAX_INHERIT_DEPTH
+static rpcProjectConfigRaw *LoadWorkspaceBase(rpcProjectWorkspace *workspace, const char *fileName, int depth)
+{
+    if ((fileName[0] == '\0') || (depth >= RPC_MAX_INHERIT_DEPTH)) return NULL;
+
+    if (!FileExists(fileName))
+    {
+        TraceLog(LOG_WARNING, "RPC: [%s] Base config file not found", fileName);
+        return NULL;
+    }
+
+    for (int i = 0; i < workspace->baseCount; i++)
+    {
+        if (TextIsEqual(workspace->baseFileNames[i], fileName)) return &workspace->bases[i];
+    }
+
+    int index = workspace->baseCount;
+    workspace->baseCount++;
+
+    strncpy(workspace->baseFileNames[index], fileName, 511);
+    workspace->bases[index] = LoadProjectConfigRaw(workspace->baseFileNames[index]);
+
+    rpcPropertyEntry *baseEntry = FindProjectConfigEntry(workspace->bases[index], RPC_BASE_FILE_KEY);
+
+    if ((baseEntry != NULL) && (baseEntry->text[0] != '\0'))
+    {
+        char baseFileName[512] = { 0 };
+        strncpy(baseFileName, GetBaseFilePath(workspace->baseFileNames[index], baseEntry->text), 511);
+
+        workspace->bases[index].base = LoadWorkspaceBase(workspace, baseFileName, depth + 1);
+
+        // Check for inheritance cycles, base reaching itself
+        int chainDepth = 0;
+        for (rpcProjectConfigRaw *base = workspace->bases[index].base; (base != NULL) && (chainDepth < RPC_MAX_INHERIT_DEPTH); base = base->base, chainDepth++)
+        {
+            if (base == &workspace->bases[index])
+            {
+                TraceLog(LOG_WARNING, "RPC: [%s] Base config inheritance cycle detected", workspace->baseFileNames[index]);
+                workspace->bases[index].base = NULL;
+                break;
+            }
+        }
+    }
+
+    return &workspace->bases[index];
+}
+
+// Save changed entries patching existing .rpc file lines
+// NOTE: Only lines of changed entries are modified, all other lines (comments, empty lines,
+// manual formatting) are kept as is, changed entries not found are added after the last entry
+// of the longest section matching the key prefix (or after the last root entry if none)
+static bool SaveProjectConfigRawIncremental(rpcProjectConfigRaw raw, const char *fileName)
+{
+    int dirtyCount = 0;
+    for (int i = 0; i < raw.entryCount; i++) if (raw.entries[i].dirty) dirtyCount++;
+
+    if (dirtyCount == 0) return true;   // Nothing to save
+
+    char *text = LoadFileText(fileName);
+    if (text == NULL) return false;
+
+    // NOTE: Worst case: every changed entry line is fully rewritten or added,
+    // key and spacing are limited but text could be long text
+    int textLength = (int)strlen(text);
+    int capacity = textLength + 1;
+
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        if (raw.entries[i].dirty) capacity += (int)strlen(GetEntryText(&raw.entries[i])) + (int)sizeof(raw.entries[i].key) +
+            (int)sizeof(raw.entries[i].desc) + RINI_KEY_SPACING + RINI_VALUE_SPACING + 16;
+    }
+
+    char *buffer = (char *)RL_CALLOC(capacity, 1);
+    bool *saved = (bool *)RL_CALLOC(raw.entryCount, sizeof(bool));
+    int *insertOffset = (int *)RL_CALLOC(raw.entryCount, sizeof(int));  // Text offset to add entry line (-1 if found on file)
+    int *prefixLength = (int *)RL_CALLOC(raw.entryCount, sizeof(int));  // Section prefix length of entry key (-1 if no section)
+    int length = 0;
+
+    for (int i = 0; i < raw.entryCount; i++) { insertOffset[i] = -1; prefixLength[i] = -1; }
+
+    // Find changed entries not on file and where to add them: after the last entry line
+    // of the longest matching section, section header if no entries, root entries at first section
+    const char *line = text;
+    rini_slice section = { 0 };     // Current section, entries keys prefixed with section name
+    char prefix[64] = { 0 };        // Current section entries keys prefix: [PLATFORM.ANDROID] -> PLATFORM_ANDROID_
+    int blockOffset = -1;           // Current section offset to add entries
+
+    while (true)
+    {
+        const char *lineEnd = strchr(line, '\n');
+        if (lineEnd == NULL) lineEnd = line + strlen(line);
+        int lineLength = (int)(lineEnd - line);
+        int nextOffset = (int)((*lineEnd == '\n')? (lineEnd + 1 - text) : (lineEnd - text));
+
+        // Section ends on next section line or at the end of file, check its entries
+        if ((*line == '\0') || (line[0] == RINI_LINE_SECTION_DELIMITER))
+        {
+            int currentPrefixLength = (int)strlen(prefix);
+            if (blockOffset < 0) blockOffset = (int)(line - text);    // Root entries added before first section
+
+            for (int i = 0; i < raw.entryCount; i++)
+            {
+                if (raw.entries[i].dirty && (raw.entries[i].key[0] != '\0') && (currentPrefixLength >= prefixLength[i]) &&
+                    ((int)strlen(raw.entries[i].key) > currentPrefixLength) && (strncmp(raw.entries[i].key, prefix, currentPrefixLength) == 0))
+                {
+                    insertOffset[i] = blockOffset;
+                    prefixLength[i] = currentPrefixLength;
+                }
+            }
+
+            if (*line == '\0') break;
+
+            // NOTE: Using rini parser to get section name, same as loading
+            rini_parser parser = rini_parser_init(line, lineLength);
+            rini_entry entry = { 0 };
+
+            rini_parse_next(&parser, &entry);
+            section = parser.section;
+            GetSectionEntryKey(section, (rini_slice){ 0 }, prefix, 64);
+            blockOffset = nextOffset;
+        }
+        else
+        {
+            char entryKey[64] = { 0 };
+
+            if (GetLineEntryKey(line, lineLength, section, entryKey, 64) > 0)
+            {
+                for (int i = 0; i < raw.entryCount; i++) if (raw.entries[i].dirty && TextIsEqual(raw.entries[i].key, entryKey)) saved[i] = true;
+                blockOffset = nextOffset;
+            }
+        }
+
+        line = lineEnd;
+        if (*line == '\n') line++;
+    }
+
+    for (int i = 0; i < raw.entryCount; i++) if (saved[i]) { insertOffset[i] = -1; saved[i] = false; }
+
+    // Patch changed entries lines and add entries not found
+    line = text;
+    section = (rini_slice){ 0 };
+
+    while (true)
+    {
+        int offset = (int)(line - text);
+
+        for (int i = 0; i < raw.entryCount; i++)
+        {
+            if (insertOffset[i] == offset)
+            {
+                if ((length > 0) && (buffer[length - 1] != '\n')) buffer[length++] = '\n';
+                length += WriteEntryLine(buffer + length, raw.entries[i].key + prefixLength[i], &raw.entries[i]);
+                saved[i] = true;
+            }
+        }
+
+        if (*line == '\0') break;
+
+        const char *lineEnd = strchr(line, '\n');
+        if (lineEnd == NULL) lineEnd = line + strlen(line);
+        int lineLength = (int)(lineEnd - line);
+
+        // Get line key (if not a comment/section line) and look for a changed entry
+        int index = -1;
+
+        if (line[0] == RINI_LINE_SECTION_DELIMITER)
+        {
+            rini_parser parser = rini_parser_init(line, lineLength);
+            rini_entry entry = { 0 };
+
+            rini_parse_next(&parser, &entry);
+            section = parser.section;
+        }
+        else
+        {
+            char entryKey[64] = { 0 };
+            int keyLength = GetLineEntryKey(line, lineLength, section, entryKey, 64);
+
+            for (int i = 0; (keyLength > 0) && (i < raw.entryCount); i++)
+            {
+                if (raw.entries[i].dirty && !saved[i] && TextIsEqual(raw.entries[i].key, entryKey)) { index = i; break; }
+            }
+        }
+
+        if (index >= 0)
+        {
+            length += PatchEntryLine(buffer + length, line, lineLength, &raw.entries[index]);
+            saved[index] = true;
+        }
+        else
+        {
+            memcpy(buffer + length, line, lineLength);
+            length += lineLength;
+        }
+
+        if (*lineEnd == '\n') { buffer[length++] = '\n'; line = lineEnd + 1; }
+        else line = lineEnd;
+    }
+
+    bool success = SaveFileDataAtomic(fileName, buffer, length);
+
+    RL_FREE(prefixLength);
+    RL_FREE(insertOffset);
+    RL_FREE(saved);
+    RL_FREE(buffer);
+    UnloadFileText(text);
+
+    return success;
+}
+
+// Patch entry value on .rpc text line, keeping key, spacing and description
+// NOTE: Spacing after value is adjusted to keep description column (if possible)
+static int PatchEntryLine(char *buffer, const char *line, int lineLength, const rpcPropertyEntry *entry)
+{
+    int keyLength = 0;
+    while ((keyLength < lineLength) && (line[keyLength] != ' ') && (line[keyLength] != '\t') &&
+        (line[keyLength] != '\r') && (line[keyLength] != RINI_VALUE_DELIMITER)) keyLength++;
+
+    int valueStart = keyLength;
+    while ((valueStart < lineLength) && ((line[valueStart] == ' ') || (line[valueStart] == '\t') || (line[valueStart] == RINI_VALUE_DELIMITER))) valueStart++;
+
+    int valueEnd = valueStart;
+    if ((valueEnd < lineLength) && (line[valueEnd] == RINI_VALUE_QUOTATION_MARKS))
+    {
+        valueEnd++;
+        while ((valueEnd < lineLength) && (line[valueEnd] != RINI_VALUE_QUOTATION_MARKS)) valueEnd++;
+        if (valueEnd < lineLength) valueEnd++;
+    }
+    else
+    {
+        while ((valueEnd < lineLength) && (line[valueEnd] != ' ') && (line[valueEnd] != '\t') &&
+            (line[valueEnd] != '\r') && (line[valueEnd] != RINI_DESCRIPTION_DELIMITER)) valueEnd++;
+    }
+
+    int spacingEnd = valueEnd;
+    while ((spacingEnd < lineLength) && ((line[spacingEnd] == ' ') || (line[spacingEnd] == '\t'))) spacingEnd++;
+
+    int valueLength = 0;
+    int length = 0;
+
+    memcpy(buffer, line, valueStart);
+    length += valueStart;
+    if (valueStart == keyLength) buffer[length++] = ' ';    // No spacing available after key
+
+    // NOTE: Value written directly (no TextFormat()), it could be long text
+    if ((entry->type == RPC_TYPE_BOOL) || (entry->type == RPC_TYPE_VALUE)) valueLength = sprintf(buffer + length, "%i", entry->value);
+    else valueLength = sprintf(buffer + length, "%c%s%c", RINI_VALUE_QUOTATION_MARKS, GetEntryText(entry), RINI_VALUE_QUOTATION_MARKS);
+    length += valueLength;
+
+    // Keep description column, at least one space required
+    if ((spacingEnd < lineLength) && (line[spacingEnd] != '\r'))
+    {
+        int spacing = (spacingEnd - valueStart) - valueLength;
+        if (spacing < 1) spacing = 1;
+
+        memset(buffer + length, ' ', spacing);
+        length += spacing;
+    }
+
+    memcpy(buffer + length, line + spacingEnd, lineLength - spacingEnd);
+    length += (lineLength - spacingEnd);
+
+    return length;
+}
+
+// Write new entry line on .rpc text: key, value and description
+// NOTE: Same format as rini saving, value is written directly (no TextFormat()), it could be long text
+static int WriteEntryLine(char *buffer, const char *key, const rpcPropertyEntry *entry)
+{
+    int length = sprintf(buffer, "%-*s %c ", RINI_KEY_SPACING, key, RINI_VALUE_DELIMITER);
+    int valueLength = 0;
+
+    if ((entry->type == RPC_TYPE_BOOL) || (entry->type == RPC_TYPE_VALUE)) valueLength = sprintf(buffer + length, "%i", entry->value);
+    else valueLength = sprintf(buffer + length, "%c%s%c", RINI_VALUE_QUOTATION_MARKS, GetEntryText(entry), RINI_VALUE_QUOTATION_MARKS);
+
+    length += valueLength;
+    for (; valueLength < RINI_VALUE_SPACING; valueLength++) buffer[length++] = ' ';
+    length += sprintf(buffer + length, " %c %s\n", RINI_DESCRIPTION_DELIMITER, entry->desc);
+
+    return length;
+}
+
+// Get entry key from .rpc text line, including section prefix
+// NOTE: Comment, section and empty lines are not key lines, returns 0
+static int GetLineEntryKey(const char *line, int lineLength, rini_slice section, char *entryKey, int size)
+{
+    if ((lineLength == 0) || (line[0] == RINI_LINE_COMMENT_DELIMITER) || (line[0] == RINI_LINE_SECTION_DELIMITER)) return 0;
+
+    rini_slice key = { line, 0 };
+    while (((int)key.len < lineLength) && (line[key.len] != ' ') && (line[key.len] != '\t') &&
+        (line[key.len] != '\r') && (line[key.len] != RINI_VALUE_DELIMITER)) key.len++;
+
+    return (key.len > 0)? GetSectionEntryKey(section, key, entryKey, size) : 0;
+}
+
+// Copy text to fixed size buffer, truncated if required
+// NOTE: Entries text (256 bytes) can be longer than some config fields (version, names)
+static void CopyTextBounded(char *dst, const char *src, int size)
+{
+    int length = 0;
+
+    if (src != NULL) for (; (length < (size - 1)) && (src[length] != '\0'); length++) dst[length] = src[length];
+
+    dst[length] = '\0';
+}
+
+// Get entry full text, long text only if text not edited
+// NOTE: Text buffer is edited in place (UI), long text is only valid while text keeps its first 255 chars
+static const char *GetEntryText(const rpcPropertyEntry *entry)
+{
+    if ((entry->longText != NULL) && (entry->text[sizeof(entry->text) - 2] != '\0') &&
+        (strncmp(entry->text, entry->longText, sizeof(entry->text) - 1) == 0)) return entry->longText;
+
+    return entry->text;
+}
+
+// Set entry full text, kept only if longer than text buffer
+static void SetEntryLongText(rpcPropertyEntry *entry, const char *text, int length)
+{
+    RL_FREE(entry->longText);
+    entry->longText = NULL;
+
+    if (length >= (int)sizeof(entry->text))
+    {
+        entry->longText = (char *)RL_MALLOC(length + 1);
+        memcpy(entry->longText, text, length);
+        entry->longText[length] = '\0';
+    }
+}
+
+// Get entry key from section and key: [PLATFORM.ANDROID] NDK_PATH -> PLATFORM_ANDROID_NDK_PATH
+// NOTE: Section name '.' separators replaced by '_', returns entry key length (truncated to size)
+static int GetSectionEntryKey(rini_slice section, rini_slice key, char *entryKey, int size)
+{
+    int length = 0;
+
+    for (unsigned int i = 0; (i < section.len) && (length < (size - 1)); i++) entryKey[length++] = (section.ptr[i] == '.')? '_' : section.ptr[i];
+    if ((section.len > 0) && (length < (size - 1))) entryKey[length++] = '_';
+    for (unsigned int i = 0; (i < key.len) && (length < (size - 1)); i++) entryKey[length++] = key.ptr[i];
+
+    entryKey[length] = '\0';
+
+    return length;
+}
+
+// Save data to file atomically
+// NOTE: Data is written to a temp file and flushed, destination file is only replaced
+// once completely written, avoiding truncated files on crash/power loss, readers keep
+// the previous file (or its memory mapping) valid; temp file name is unique per process
+static bool SaveFileDataAtomic(const char *fileName, const void *data, int size)
+{
+    char tempFileName[512] = { 0 };
+#if defined(_WIN32)
+    strncpy(tempFileName, TextFormat("%s.%i.tmp", fileName, (int)_getpid()), 511);
+#else
+    strncpy(tempFileName, TextFormat("%s.%i.tmp", fileName, (int)getpid()), 511);
+#endif
+
+    FILE *file = fopen(tempFileName, "wb");
+    if (file == NULL) return false;
+
+    bool success = (fwrite(data, 1, size, file) == (size_t)size);
+    fclose(file);
+
+    if (success) success = ReplaceFileAtomic(tempFileName, fileName);
+    else remove(tempFileName);
+
+    return success;
+}
+
+// Flush temp file to disk and replace file
+// NOTE: rename() replaces atomically on POSIX, MoveFileExA() required on Windows to replace existing file
+static bool ReplaceFileAtomic(const char *tempFileName, const char *fileName)
+{
+    bool success = false;
+
+#if defined(_WIN32)
+    int fd = _open(tempFileName, _O_RDWR | _O_BINARY);
+    if (fd >= 0) { _commit(fd); _close(fd); }
+
+    success = (MoveFileExA(tempFileName, fileName, 0x01 | 0x08) != 0);    // MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+#else
+    int fd = open(tempFileName, O_RDWR);
+    if (fd >= 0) { fsync(fd); close(fd); }
+
+    success = (rename(tempFileName, fileName) == 0);
+#endif
+
+    if (!success) remove(tempFileName);
+
+    return success;
+}
+
+// Find entry by key, looking into base configs if not found
+// NOTE: Entry reference encoded as: (base level << 16) | entry index, level 0 is project
+static rpcPropertyEntry *FindProjectConfigEntryRef(rpcProjectConfigRaw raw, const char *key, int *ref)
+{
+    int level = 0;
+
+    for (rpcProjectConfigRaw *config = &raw; config != NULL; config = config->base, level++)
+    {
+        for (int i = 0; i < config->entryCount; i++)
+        {
+            if (TextIsEqual(config->entries[i].key, key))
+            {
+                *ref = (level << 16) | i;
+                return &config->entries[i];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Check if entry memoized resolved text is still valid
+// NOTE: Valid while entry and all referenced entries have not changed after resolving,
+// only for the config it was resolved for (base entries are shared by multiple projects)
+static bool IsEntryResolvedValid(rpcProjectConfigRaw raw, const rpcPropertyEntry *entry)
+{
+    if (!entry->resolvedValid || (entry->resolved == NULL) || (entry->resolvedConfigId != raw.id)) return false;
+    if ((entry->revision > entry->resolvedRevision) || (layoutRevision > entry->resolvedRevision)) return false;
+
+    for (int d = 0; d < entry->depCount; d++)
+    {
+        rpcProjectConfigRaw *config = &raw;
+        for (int level = (entry->deps[d] >> 16); (level > 0) && (config != NULL); level--) config = config->base;
+
+        int index = entry->deps[d] & 0xffff;
+
+        if ((config == NULL) || (index >= config->entryCount)) return false;
+        if (config->entries[index].revision > entry->resolvedRevision) return false;
+    }
+
+    return true;
+}
+
+// Resolve entry text, memoized
+// NOTE: Referenced entries are added to parent resolve state (if provided)
+static const char *ResolveEntryTextMemo(rpcProjectConfigRaw raw, rpcPropertyEntry *entry, rpcResolveState *state)
+{
+    if (!IsEntryResolvedValid(raw, entry))
+    {
+        rpcResolveState entryState = { 0 };
+
+        // Keep entries being resolved for cycles detection
+        if (state != NULL)
+        {
+            for (int s = 0; s < state->depth; s++) entryState.stack[s] = state->stack[s];
+            entryState.depth = state->depth;
+        }
+
+        char *resolved = ResolveEntryText(raw, entry, &entryState);
+
+        RL_FREE(entry->resolved);
+        entry->resolved = resolved;
+        entry->resolvedRevision = entryRevisionCounter;
+        entry->resolvedConfigId = raw.id;
+        entry->resolvedValid = (entryState.depCount >= 0);
+        entry->depCount = entry->resolvedValid? entryState.depCount : 0;
+        for (int d = 0; d < entry->depCount; d++) entry->deps[d] = entryState.deps[d];
+    }
+
+    if ((state != NULL) && (state->depCount >= 0))
+    {
+        if (!entry->resolvedValid) state->depCount = -1;
+        else
+        {
+            for (int d = 0; (d < entry->depCount) && (state->depCount >= 0); d++)
+            {
+                bool found = false;
+                for (int k = 0; k < state->depCount; k++) if (state->deps[k] == entry->deps[d]) { found = true; break; }
+
+                if (!found)
+                {
+                    if (state->depCount < RPC_MAX_REFERENCE_DEPS) state->deps[state->depCount++] = entry->deps[d];
+                    else state->depCount = -1;
+                }
+            }
+        }
+    }
+
+    return entry->resolved;
+}
+
+// Resolve entry text references into new allocated text
+// NOTE: Cyclic references and references over RPC_MAX_REFERENCE_DEPTH are kept as is,
+// resolved text grows as required, no length limit
+static char *ResolveEntryText(rpcProjectConfigRaw raw, const rpcPropertyEntry *entry, rpcResolveState *state)
+{
+    char valueText[16] = { 0 };
+    const char *text = GetEntryText(entry);
+
+    // NOTE: Value entries text could be outdated if value modified directly
+    if ((entry->type == RPC_TYPE_BOOL) || (entry->type == RPC_TYPE_VALUE))
+    {
+        snprintf(valueText, 16, "%i", entry->value);
+        text = valueText;
+    }
+
+    state->stack[state->depth] = entry;
+    state->depth++;
+
+    // NOTE: Capacity always available for remaining text, only grows when a reference is replaced
+    int capacity = (int)strlen(text) + 1;
+    char *resolved = (char *)RL_MALLOC(capacity);
+    int length = 0;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        const char *end = NULL;
+        if ((text[i] == '$') && (text[i + 1] == '{')) end = strchr(text + i + 2, '}');
+
+        if (end == NULL)
+        {
+            resolved[length] = text[i];
+            length++;
+            i++;
+            continue;
+        }
+
+        int keyLength = (int)(end - (text + i + 2));
+        const char *value = NULL;
+
+        if (keyLength < 64)
+        {
+            char key[64] = { 0 };
+            memcpy(key, text + i + 2, keyLength);
+
+            int ref = 0;
+            rpcPropertyEntry *refEntry = FindProjectConfigEntryRef(raw, key, &ref);
+
+            if (refEntry != NULL)
+            {
+                bool cycle = false;
+                for (int s = 0; s < state->depth; s++) if (state->stack[s] == refEntry) { cycle = true; break; }
+
+                // NOTE: Reference kept as is depends on the entries being resolved (caller stack),
+                // resolved text is not memoizable in that case
+                if (cycle)
+                {
+                    TraceLog(LOG_WARNING, "RPC: [%s] Reference cycle detected: ${%s}", entry->key, key);
+                    state->depCount = -1;
+                }
+                else if (state->depth >= RPC_MAX_REFERENCE_DEPTH)
+                {
+                    TraceLog(LOG_WARNING, "RPC: [%s] Reference depth limit reached: ${%s}", entry->key, key);
+                    state->depCount = -1;
+                }
+                else
+                {
+                    if (state->depCount >= 0)
+                    {
+                        bool found = false;
+                        for (int k = 0; k < state->depCount; k++) if (state->deps[k] == ref) { found = true; break; }
+
+                        if (!found)
+                        {
+                            if (state->depCount < RPC_MAX_REFERENCE_DEPS) state->deps[state->depCount++] = ref;
+                            else state->depCount = -1;
+                        }
+                    }
+
+                    // NOTE: Base config entries are resolved against project entries, memoized for this project
+                    value = ResolveEntryTextMemo(raw, refEntry, state);
+                }
+            }
+            else value = getenv(key);   // NOTE: Environment variables are considered constant, not tracked
+        }
+
+        int refLength = keyLength + 3;  // Reference kept as is: ${KEY}
+        if (value != NULL) refLength = (int)strlen(value);
+        else value = text + i;
+
+        i += (keyLength + 3);
+
+        int required = length + refLength + (int)strlen(text + i) + 1;
+
+        if (required > capacity)
+        {
+            while (capacity < required) capacity *= 2;
+            resolved = (char *)RL_REALLOC(resolved, capacity);
+        }
+
+        memcpy(resolved + length, value, refLength);
+        length += refLength;
+    }
+
+    resolved[length] = '\0';
+    state->depth--;
+
+    return resolved;
+}
+
+// Compute path hash (djb2)
+static unsigned int ComputePathHash(const char *path)
+{
+    unsigned int hash = 5381;
+
+    for (int i = 0; path[i] != '\0'; i++) hash = ((hash << 5) + hash) + (unsigned char)path[i];
+
+    return hash;
+}
+
+// Validate path job: stat path (and required file if not cached)
+// NOTE: Called from validation threads, only thread-safe functions can be used (no TextFormat())
+static void ValidatePathJob(rpcPathValidationJob *job)
+{
+    RPC_STAT_STRUCT info = { 0 };
+
+    if (job->path[0] == '\0') { job->status = RPC_STATUS_NONE; return; }
+    if (RPC_STAT(job->path, &info) != 0) { job->status = RPC_STATUS_NOT_FOUND; return; }
+
+    bool isDirectory = RPC_STAT_IS_DIR(info.st_mode);
+    job->modTime = (long long)info.st_mtime;
+
+    if ((job->type == RPC_TYPE_TEXT_FILE) && isDirectory) { job->status = RPC_STATUS_INVALID; return; }
+    if ((job->type == RPC_TYPE_TEXT_PATH) && !isDirectory) { job->status = RPC_STATUS_INVALID; return; }
+
+    job->status = RPC_STATUS_VALID;
+
+    if (job->requiredFile != NULL)
+    {
+        // Check cache, directory modification time changes if content is added/removed
+        unsigned int hash = ComputePathHash(job->path);
+
+        for (int c = 0; c < validationCacheCount; c++)
+        {
+            if ((validationCache[c].hash == hash) && (validationCache[c].modTime == job->modTime) && TextIsEqual(validationCache[c].path, job->path))
+            {
+                job->status = validationCache[c].status;
+                job->cached = true;
+                return;
+            }
+        }
+
+        char requiredPath[600] = { 0 };
+        snprintf(requiredPath, 600, "%s/%s", job->path, job->requiredFile);
+
+        if (RPC_STAT(requiredPath, &info) != 0) job->status = RPC_STATUS_INVALID;
+    }
+}
+
+// Validate path jobs assigned to thread
+static void ValidatePathJobs(rpcPathValidationWork *work)
+{
+    for (int i = work->first; i < work->jobCount; i += work->stride) ValidatePathJob(&work->jobs[i]);
+
+#if defined(RPC_SUPPORT_THREADS) && !defined(_WIN32)
+    if (work->lock != NULL) pthread_mutex_lock(work->lock);
+    work->finished = true;
+    if (work->lock != NULL) pthread_mutex_unlock(work->lock);
+#else
+    work->finished = true;
+#endif
+}
+
+// Prepare path jobs and dispatch them to threads
+// NOTE: On background validation all jobs sets are processed by threads, calling thread only processes
+// the jobs sets of threads that could not be created; otherwise calling thread processes first jobs set
+static rpcPathValidation *StartPathValidation(rpcProjectConfigRaw raw, const char *basePath, bool background)
+{
+    int jobCount = 0;
+
+    for (int i = 0; i < raw.entryCount; i++)
+    {
+        if ((raw.entries[i].type == RPC_TYPE_TEXT_FILE) || (raw.entries[i].type == RPC_TYPE_TEXT_PATH)) jobCount++;
+    }
+
+    rpcPathValidation *validation = (rpcPathValidation *)RL_CALLOC(1, sizeof(rpcPathValidation));
+    validation->jobs = (rpcPathValidationJob *)RL_CALLOC((jobCount > 0)? jobCount : 1, sizeof(rpcPathValidationJob));
+    validation->jobEntries = (int *)RL_CALLOC((jobCount > 0)? jobCount : 1, sizeof(int));
+    validation->jobCount = jobCount;
+    validation->configId = raw.id;
+
+    rpcPathValidationJob *jobs = validation->jobs;
+
+    // Prepare jobs, resolving entries text references
+    // NOTE: Resolved text is memoized on entries, not thread-safe, it must be done before dispatching,
+    // jobs keep their own copy of paths, threads never access entries
+    for (int i = 0, k = 0; i < raw.entryCount; i++)
+    {
+        if ((raw.entries[i].type != RPC_TYPE_TEXT_FILE) && (raw.entries[i].type != RPC_TYPE_TEXT_PATH)) continue;
+
+        const char *path = GetProjectConfigEntryResolved(raw, &raw.entries[i]);
+        bool absolutePath = ((path[0] == '/') || (path[0] == '\\') || ((path[0] != '\0') && (path[1] == ':')));
+
+        if ((path[0] == '\0') || absolutePath || (basePath == NULL) || (basePath[0] == '\0')) snprintf(jobs[k].path, 512, "%s", path);
+        else snprintf(jobs[k].path, 512, "%s/%s", basePath, path);
+
+        jobs[k].type = raw.entries[i].type;
+
+        for (int r = 0; r < (int)(sizeof(pathRequirements)/sizeof(pathRequirements[0])); r++)
+        {
+            if (TextIsEqual(raw.entries[i].key, pathRequirements[r].key)) { jobs[k].requiredFile = pathRequirements[r].requiredFile; break; }
+        }
+
+        validation->jobEntries[k] = i;
+        k++;
+    }
+
+    // Dispatch jobs to threads, interleaved
+    // NOTE: Cache is only read by threads, it is updated once all threads finished
+    int threadCount = (jobCount < RPC_MAX_VALIDATION_THREADS)? jobCount : RPC_MAX_VALIDATION_THREADS;
+    if (threadCount < 1) threadCount = 1;
+    validation->threadCount = threadCount;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        validation->work[t].jobs = jobs;
+        validation->work[t].jobCount = jobCount;
+        validation->work[t].first = t;
+        validation->work[t].stride = threadCount;
+    }
+
+#if defined(RPC_SUPPORT_THREADS)
+  #if !defined(_WIN32)
+    pthread_mutex_init(&validation->lock, NULL);
+    for (int t = 0; t < threadCount; t++) validation->work[t].lock = &validation->lock;
+  #endif
+
+    for (int t = (background? 0 : 1); t < threadCount; t++)
+    {
+        if (jobCount == 0) break;
+
+      #if defined(_WIN32)
+        validation->threads[t] = _beginthreadex(NULL, 0, ValidatePathJobsThread, &validation->work[t], 0, NULL);
+        validation->threadCreated[t] = (validation->threads[t] != 0);
+      #else
+        validation->threadCreated[t] = (pthread_create(&validation->threads[t], NULL, ValidatePathJobsThread, &validation->work[t]) == 0);
+      #endif
+    }
+
+    // Process jobs sets without thread on calling thread
+    for (int t = 0; t < threadCount; t++)
+    {
+        if (!validation->threadCreated[t]) ValidatePathJobs(&validation->work[t]);
+    }
+#else
+    (void)background;
+    for (int t = 0; t < threadCount; t++) ValidatePathJobs(&validation->work[t]);
+#endif
+
+    return validation;
+}
+
+// Check if all path jobs have been processed (no wait)
+static bool IsPathValidationFinished(rpcPathValidation *validation)
+{
+    bool finished = true;
+
+#if defined(RPC_SUPPORT_THREADS) && !defined(_WIN32)
+    pthread_mutex_lock(&validation->lock);
+    for (int t = 0; t < validation->threadCount; t++) if (!validation->work[t].finished) finished = false;
+    pthread_mutex_unlock(&validation->lock);
+#elif defined(RPC_SUPPORT_THREADS)
+    for (int t = 0; t < validation->threadCount; t++)
+    {
+        if (validation->threadCreated[t] && (WaitForSingleObject((void *)validation->threads[t], 0) != 0)) finished = false;  // WAIT_OBJECT_0
+    }
+#else
+    (void)validation;
+#endif
+
+    return finished;
+}
+
+// Wait for path jobs, update entries status and validation cache, validation is freed
+// NOTE: Returns not valid entries count
+static int FinishPathValidation(rpcProjectConfigRaw raw, rpcPathValidation *validation)
+{
+    int invalidCount = 0;
+    rpcPathValidationJob *jobs = validation->jobs;
+
+#if defined(RPC_SUPPORT_THREADS)
+    for (int t = 0; t < validation->threadCount; t++)
+    {
+        if (validation->threadCreated[t])
+        {
+          #if defined(_WIN32)
+            WaitForSingleObject((void *)validation->threads[t], 0xffffffff);
+            CloseHandle((void *)validation->threads[t]);
+          #else
+            pthread_join(validation->threads[t], NULL);
+          #endif
+        }
+    }
+  #if !defined(_WIN32)
+    pthread_mutex_destroy(&validation->lock);
+  #endif
+#endif
+
+    // NOTE: Validation cache is not updated while a background validation is running (read by its threads)
+    bool updateCache = ((backgroundValidation == NULL) || (backgroundValidation == validation));
+
+    // Update entries status and validation cache
+    for (int k = 0; k < validation->jobCount; k++)
+    {
+        if (validation->jobEntries[k] < raw.entryCount) raw.entries[validation->jobEntries[k]].status = jobs[k].status;
+
+        if ((jobs[k].status == RPC_STATUS_NOT_FOUND) || (jobs[k].status == RPC_STATUS_INVALID)) invalidCount++;
+
+        if (updateCache && !jobs[k].cached && (jobs[k].requiredFile != NULL) && (jobs[k].status != RPC_STATUS_NOT_FOUND))
+        {
+            unsigned int hash = ComputePathHash(jobs[k].path);
+            int index = -1;
+
+            for (int c = 0; c < validationCacheCount; c++)
+            {
+                if ((validationCache[c].hash == hash) && TextIsEqual(validationCache[c].path, jobs[k].path)) { index = c; break; }
+            }
+
+            if (index == -1)
+            {
+                if (validationCacheCount < RPC_MAX_VALIDATION_CACHE) index = validationCacheCount++;
+                else
+                {
+                    index = validationCacheNext;
+                    validationCacheNext = (validationCacheNext + 1)%RPC_MAX_VALIDATION_CACHE;
+                }
+            }
+
+            validationCache[index].hash = hash;
+            strncpy(validationCache[index].path, jobs[k].path, 511);
+            validationCache[index].modTime = jobs[k].modTime;
+            validationCache[index].status = jobs[k].status;
+        }
+    }
+
+    RL_FREE(validation->jobEntries);
+    RL_FREE(validation->jobs);
+    RL_FREE(validation);
+
+    return invalidCount;
+}
+
+#if defined(RPC_SUPPORT_THREADS)
+// Validation thread entry point
+#if defined(_WIN32)
+static unsigned int __stdcall ValidatePathJobsThread(void *arg)
+{
+    ValidatePathJobs((rpcPathValidationWork *)arg);
+    return 0;
+}
+#else
+static void *ValidatePathJobsThread(void *arg)
+{
+    ValidatePathJobs((rpcPathValidationWork *)arg);
+    return NULL;
+}
+#endif
+#endif
+
+// Get key token from key word, NULL if not a keyword
+static const rpcKeyToken *GetKeyToken(const char *token, int length)
+{
+    if (length == 0) return NULL;
+
+    const rpcKeyToken *keyToken = &keyTokens[RPC_KEY_TOKEN_HASH(token, length)];
+
+    if ((keyToken->length == length) && (memcmp(keyToken->text, token, length) == 0)) return keyToken;
+
+    return NULL;
+}
+
+// Classify entry key: category, platform, type and display name
+// NOTE: Key is scanned once, words separated by '_' are looked up as tokens:
+//  - First word: category (PROJECT, BUILD, PLATFORM, DEPLOY, IMAGERY, RAYLIB)
+//  - Second word (PLATFORM category): platform (WINDOWS, LINUX, MACOS, HTML5, ANDROID...)
+//  - Any word FLAG (value entries): boolean, display as checkbox
+//  - Last word FILE, FILES or PATH (text entries): file or directory path
+// Display name is the key after category (and platform) words, '_' replaced by spaces
+static void ClassifyEntryKey(rpcPropertyEntry *entry, bool isValue)
+{
+    const char *key = entry->key;
+    int nameStart = 0;
+    int lastTokenType = RPC_TYPE_TEXT;
+    bool flag = false;
+
+    entry->category = RPC_CAT_NONE;
+    entry->platform = RPC_PLATFORM_ANY;
+
+    for (int i = 0, wordStart = 0, word = 0; ; i++)
+    {
+        if ((key[i] != '_') && (key[i] != '\0')) continue;
+
+        // Word found: [wordStart, i)
+        const rpcKeyToken *token = GetKeyToken(key + wordStart, i - wordStart);
+        lastTokenType = RPC_TYPE_TEXT;
+
+        if (token != NULL)
+        {
+            if ((word == 0) && (token->kind == RPC_TOKEN_CATEGORY))
+            {
+                entry->category = token->id;
+                nameStart = i + 1;
+            }
+            else if ((word == 1) && (token->kind == RPC_TOKEN_PLATFORM) && (entry->category == RPC_CAT_PLATFORM))
+            {
+                entry->platform = token->id;
+                nameStart = i + 1;
+            }
+            else if (token->kind == RPC_TOKEN_FLAG) flag = true;
+            else if (token->kind == RPC_TOKEN_TYPE) lastTokenType = token->id;
+        }
+
+        if (key[i] == '\0') break;
+
+        wordStart = i + 1;
+        word++;
+    }
+
+    if (isValue) entry->type = flag? RPC_TYPE_BOOL : RPC_TYPE_VALUE;
+    else entry->type = lastTokenType;
+
+    // Key without category word is displayed complete
+    if (key[nameStart] == '\0') nameStart = 0;
+
+    memset(entry->name, 0, sizeof(entry->name));
+    for (int i = 0; (key[nameStart + i] != '\0') && (i < (int)sizeof(entry->name) - 1); i++) entry->name[i] = (key[nameStart + i] == '_')? ' ' : key[nameStart + i];
+}
+
 #endif // RPCDATA_IMPLEMENTATION
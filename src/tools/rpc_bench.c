@@ -0,0 +1,223 @@
+/*******************************************************************************************
+*
+*   rpc_bench - rini and rpconfig throughput micro-benchmark
+*
+*   Generated configs from 10 to 100k entries are loaded, saved and synced,
+*   every operation reports time per entry (ns/entry) and allocations per run
+*
+*   NOTE: Allocations counted through RINI_* and RL_* allocators, raylib internal
+*   allocations (i.e. LoadFileText()) are not included
+*
+*   USAGE:
+*       rpc_bench [temp_file_path]    - Generated .rpc file saved to temp_file_path (default: rpc_bench.rpc)
+*
+*   BUILDING:
+*       make bench (from src directory), it requires raylib
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free()
+#include <stdio.h>                  // Required for: printf(), sprintf(), remove()
+#include <string.h>                 // Required for: strlen()
+
+#if defined(_WIN32)
+    // NOTE: Avoiding <windows.h> inclusion, it conflicts with some libraries (raylib)
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *lpPerformanceCount);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *lpFrequency);
+#else
+    #include <time.h>               // Required for: clock_gettime()
+#endif
+
+static long long allocCount = 0;    // Allocations counter (malloc, calloc, realloc)
+
+static void *CountedMalloc(size_t size) { allocCount++; return malloc(size); }
+static void *CountedCalloc(size_t count, size_t size) { allocCount++; return calloc(count, size); }
+static void *CountedRealloc(void *ptr, size_t size) { allocCount++; return realloc(ptr, size); }
+
+// NOTE: Allocators defined before including raylib.h, rpconfig and rini use them
+#define RL_MALLOC(size)             CountedMalloc(size)
+#define RL_CALLOC(count, size)      CountedCalloc(count, size)
+#define RL_REALLOC(ptr, size)       CountedRealloc(ptr, size)
+#define RL_FREE(ptr)                free(ptr)
+
+#define RINI_MALLOC(size)           CountedMalloc(size)
+#define RINI_CALLOC(count, size)    CountedCalloc(count, size)
+#define RINI_REALLOC(ptr, size)     CountedRealloc(ptr, size)
+#define RINI_FREE(ptr)              free(ptr)
+
+#include "raylib.h"
+
+#define RPCONFIG_IMPLEMENTATION
+#include "rpconfig.h"               // Project config data types and functionality
+
+#define RINI_IMPLEMENTATION
+#include "external/rini.h"          // Config file values reader/writer
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark timing result
+typedef struct {
+    double nsPerEntry;              // Time per entry (nanoseconds)
+    long long allocs;               // Allocations per run
+} BenchResult;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetTimeNs(void);      // Get monotonic time in nanoseconds
+static char *GenerateConfigText(int entryCount);    // Generate .rpc text with entryCount entries
+static int GetRunsCount(int entryCount);            // Get runs required to measure entryCount entries
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *fileName = (argc > 1)? argv[1] : "rpc_bench.rpc";
+    char cacheFileName[512] = { 0 };
+    snprintf(cacheFileName, 512, "%sb", fileName);     // NOTE: Binary cache generated by SaveProjectConfigRaw()
+    const int sizes[] = { 10, 100, 1000, 10000, 100000 };
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    printf("%8s | %-24s | %-24s | %-24s | %-24s | %-24s | %-24s\n", "entries", "rini_load_from_memory",
+        "rini_save_to_memory", "LoadProjectConfigRaw", "LoadProjectConfigRaw*", "SaveProjectConfigRaw", "SyncProjectConfig");
+    printf("%8s | %-24s | %-24s | %-24s | %-24s | %-24s | %-24s\n", "", "ns/entry (allocs)", "ns/entry (allocs)",
+        "ns/entry (allocs)", "ns/entry (allocs), cached", "ns/entry (allocs)", "ns/entry (allocs)");
+
+    for (int s = 0; s < (int)(sizeof(sizes)/sizeof(sizes[0])); s++)
+    {
+        int entryCount = sizes[s];
+        int runs = GetRunsCount(entryCount);
+        char *text = GenerateConfigText(entryCount);
+        BenchResult results[6] = { 0 };
+        double time = 0.0;
+        long long allocs = 0;
+
+        SaveFileText(fileName, text);
+
+        // rini: load and save from/to memory
+        rini_data data = { 0 };
+        time = GetTimeNs(); allocs = allocCount;
+        for (int r = 0; r < runs; r++) { if (r > 0) rini_unload(&data); data = rini_load_from_memory(text); }
+        results[0] = (BenchResult){ (GetTimeNs() - time)/runs/entryCount, (allocCount - allocs)/runs };
+
+        time = GetTimeNs(); allocs = allocCount;
+        for (int r = 0; r < runs; r++) rini_unload_text(rini_save_to_memory(data));
+        results[1] = (BenchResult){ (GetTimeNs() - time)/runs/entryCount, (allocCount - allocs)/runs };
+        rini_unload(&data);
+
+        // rpconfig: load from .rpc text (no binary cache available)
+        rpcProjectConfigRaw raw = { 0 };
+        remove(cacheFileName);
+        time = GetTimeNs(); allocs = allocCount;
+        for (int r = 0; r < runs; r++) { if (r > 0) UnloadProjectConfigRaw(raw); raw = LoadProjectConfigRaw(fileName); }
+        results[2] = (BenchResult){ (GetTimeNs() - time)/runs/entryCount, (allocCount - allocs)/runs };
+
+        // rpconfig: save (full), binary cache regenerated on every save
+        time = GetTimeNs(); allocs = allocCount;
+        for (int r = 0; r < runs; r++) SaveProjectConfigRaw(raw, fileName, RPC_SAVE_FULL);
+        results[4] = (BenchResult){ (GetTimeNs() - time)/runs/entryCount, (allocCount - allocs)/runs };
+
+        // rpconfig: load from binary cache
+        time = GetTimeNs(); allocs = allocCount;
+        for (int r = 0; r < runs; r++) { UnloadProjectConfigRaw(raw); raw = LoadProjectConfigRaw(fileName); }
+        results[3] = (BenchResult){ (GetTimeNs() - time)/runs/entryCount, (allocCount - allocs)/runs };
+
+        // rpconfig: sync raw data to project config
+        rpcProjectConfig *config = (rpcProjectConfig *)calloc(1, sizeof(rpcProjectConfig));
+        time = GetTimeNs(); allocs = allocCount;
+        for (int r = 0; r < runs; r++) SyncProjectConfig(config, raw);
+        results[5] = (BenchResult){ (GetTimeNs() - time)/runs/entryCount, (allocCount - allocs)/runs };
+        free(config);
+
+        UnloadProjectConfigRaw(raw);
+        free(text);
+
+        printf("%8i", entryCount);
+        for (int i = 0; i < 6; i++) printf(" | %10.1f (%10lli)  ", results[i].nsPerEntry, results[i].allocs);
+        printf("\n");
+    }
+
+    remove(fileName);
+    remove(cacheFileName);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get monotonic time in nanoseconds
+static double GetTimeNs(void)
+{
+#if defined(_WIN32)
+    long long counter = 0, frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter*1e9/(double)frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec*1e9 + (double)now.tv_nsec;
+#endif
+}
+
+// Generate .rpc text with entryCount entries
+// NOTE: Entries types mixed as on project template: text, path, flag and value
+static char *GenerateConfigText(int entryCount)
+{
+    char *text = (char *)malloc((size_t)entryCount*128 + 1);
+    int length = 0;
+
+    for (int i = 0; i < entryCount; i++)
+    {
+        switch (i%4)
+        {
+            case 0: length += sprintf(text + length, "PROJECT_NAME_%i            \"project %i\"            # Project name %i\n", i, i, i); break;
+            case 1: length += sprintf(text + length, "BUILD_SOURCE_%i_PATH       \"src/module_%i\"         # Source path %i\n", i, i, i); break;
+            case 2: length += sprintf(text + length, "BUILD_FLAG_OPTION_%i       %i                        # Build flag %i\n", i, i&1, i); break;
+            case 3: length += sprintf(text + length, "PLATFORM_ANDROID_VALUE_%i  %i                        # Platform value %i\n", i, i, i); break;
+            default: break;
+        }
+    }
+
+    text[length] = '\0';
+
+    return text;
+}
+
+// Get runs required to measure entryCount entries
+// NOTE: Around 1M entries processed per operation, at least one run
+static int GetRunsCount(int entryCount)
+{
+    int runs = 1000000/entryCount;
+
+    if (runs > 1000) runs = 1000;
+    else if (runs < 1) runs = 1;
+
+    return runs;
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************************
+*
+*   rpc_fuzz - rini and rpconfig libFuzzer harness
+*
+*   Every input is parsed by rini (load, save, reload and save again: saved text must match)
+*   and by rpconfig (load, sync to project config and references resolving)
+*
+*   NOTE: Corpus seeded from resources/project_template.rpc, crashes, sanitizer errors
+*   and rini save roundtrip mismatches (abort) are reported by libFuzzer
+*
+*   BUILDING:
+*       make fuzz (from src directory), it requires clang (libFuzzer) and raylib
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RPCONFIG_IMPLEMENTATION
+#include "rpconfig.h"               // Project config data types and functionality
+
+#define RINI_IMPLEMENTATION
+#include "external/rini.h"          // Config file values reader/writer
+
+#include <stdlib.h>                 // Required for: malloc(), free(), abort()
+#include <string.h>                 // Required for: memcpy(), strcmp()
+#include <stdint.h>                 // Required for: uint8_t
+
+// libFuzzer initialization, called once
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    (void)argc;
+    (void)argv;
+
+    SetTraceLogLevel(LOG_NONE);
+
+    return 0;
+}
+
+// libFuzzer entry point, called for every input
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    // NOTE: rini and rpconfig expect NULL terminated text
+    char *text = (char *)malloc(size + 1);
+    memcpy(text, data, size);
+    text[size] = '\0';
+
+    // rini: load and save, saved text must be stable on reload
+    rini_data config = rini_load_from_memory(text);
+    char *saved = rini_save_to_memory(config);
+    rini_data reloaded = rini_load_from_memory(saved);
+    char *resaved = rini_save_to_memory(reloaded);
+
+    if (strcmp(saved, resaved) != 0) abort();
+
+    for (unsigned int i = 0; i < config.count; i++)
+    {
+        rini_get_value(config, config.values[i].key);
+        rini_get_value_float(config, config.values[i].key);
+        rini_get_value_list_item(config, config.values[i].key, 1);
+    }
+
+    rini_unload_text(resaved);
+    rini_unload_text(saved);
+    rini_unload(&reloaded);
+    rini_unload(&config);
+
+    // rpconfig: load, sync to project config and resolve references
+    rpcProjectConfigRaw raw = LoadProjectConfigRawFromText(text);
+    rpcProjectConfig *project = (rpcProjectConfig *)RL_CALLOC(1, sizeof(rpcProjectConfig));
+
+    SyncProjectConfig(project, raw);
+    for (int i = 0; i < raw.entryCount; i++) if (raw.entries[i].key[0] != '\0') GetProjectConfigTextResolved(raw, raw.entries[i].key);
+
+    RL_FREE(project);
+    UnloadProjectConfigRaw(raw);
+    free(text);
+
+    return 0;
+}